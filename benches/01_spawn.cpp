@@ -0,0 +1,82 @@
+/**
+ * @file 01_spawn.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Spawn-to-first-instruction and join latency of `simply::Thread` against `std::thread`/`std::jthread`,
+ * and of a `simply::Thread` reusing a `simply::ThreadCache` thread
+ */
+#include <simply/threading.h>
+
+#include "bench.h"
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+using bench::Clock;
+
+// Time from starting construction until the thread runs, and from the
+// thread returning until join returns. The thread sleeps briefly before
+// returning, so join is already blocked by then.
+template <class Spawn>
+void spawn_and_join(const std::string& name, int iterations, Spawn spawn) {
+    bench::Samples started(name + " spawn");
+    bench::Samples joined(name + " join");
+    for ( int i = 0; i < iterations; i++ ) {
+        Clock::time_point first, last;
+        auto body = [&first, &last](){
+            first = Clock::now();
+            simply::this_thread::sleep_for(std::chrono::microseconds(200));
+            last = Clock::now();
+        };
+        Clock::time_point begin = Clock::now();
+        auto thread = spawn(body);
+        thread.join();
+        Clock::time_point end = Clock::now();
+        started.add(begin, first);
+        joined.add(last, end);
+    }
+    started.report();
+    joined.report();
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 2000);
+
+    spawn_and_join("std::thread", n, [](auto body){ return std::thread(body); });
+    #if SIMPLY_std20plus
+        spawn_and_join("std::jthread", n, [](auto body){ return std::jthread(body); });
+    #endif
+
+    spawn_and_join("simply::Thread", n, [](auto body){ return simply::Thread(body); });
+
+    // Over 64 bytes, so the payload takes the heap path through _start
+    std::array<char, 128> padding {};
+    spawn_and_join("simply::Thread (heap payload)", n, [&padding](auto body){
+        return simply::Thread([body, padding](){ body(); (void) padding; });
+    });
+
+    spawn_and_join("simply::Thread (named)", n, [](auto body){
+        return simply::Thread(simply::Thread::Attributes().name("bench"), body);
+    });
+
+    #if SIMPLY_LINUX
+        simply::StackPool pool(64 * 1024, 0, true);
+        pool.reserve(1);
+        spawn_and_join("simply::Thread (StackPool)", n, [&pool](auto body){
+            return simply::Thread(pool, body);
+        });
+    #endif
+
+    // A thread joined right before may not have parked yet, which spawns a new one
+    simply::ThreadCache::enable();
+    spawn_and_join("simply::Thread (ThreadCache)", n, [](auto body){ return simply::Thread(body); });
+    simply::ThreadCache::Stats stats = simply::ThreadCache::stats();
+    std::printf("ThreadCache: %llu spawned, %llu reused\n",
+                static_cast<unsigned long long>(stats.spawned), static_cast<unsigned long long>(stats.reused));
+    simply::ThreadCache::disable();
+}
@@ -0,0 +1,42 @@
+/**
+ * @file 02_sleep.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Overshoot of `simply::this_thread` sleeps against `std::this_thread`
+ */
+#include <simply/threading.h>
+
+#include "bench.h"
+
+#include <thread>
+
+using bench::Clock;
+
+// How late each sleep returned
+template <class Sleep>
+void overshoot(const std::string& name, int iterations, std::chrono::microseconds duration, Sleep sleep) {
+    bench::Samples late(name + " " + std::to_string(duration.count()) + "us");
+    for ( int i = 0; i < iterations; i++ ) {
+        Clock::time_point deadline = Clock::now() + duration;
+        sleep(duration, deadline);
+        late.add(deadline, Clock::now());
+    }
+    late.histogram();
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 1000);
+    using std::chrono::microseconds;
+
+    for ( auto duration : {microseconds(50), microseconds(200), microseconds(1000)} ) {
+        overshoot("std::this_thread::sleep_for", n, duration, [](auto d, auto){ std::this_thread::sleep_for(d); });
+        overshoot("simply::this_thread::sleep_for", n, duration, [](auto d, auto){ simply::this_thread::sleep_for(d); });
+        overshoot("simply::this_thread::sleep_until", n, duration, [](auto, auto t){ simply::this_thread::sleep_until(t); });
+        overshoot("simply::this_thread::sleep_until (spin 50us)", n, duration, [](auto, auto t){
+            simply::this_thread::sleep_until(t, microseconds(50));
+        });
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file 03_stop.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Latency from requesting a stop until the thread has been joined
+ *
+ * For C++ 17 the stop is an atomic flag, for C++ 20 the thread's own stop_token,
+ * either polled or slept on
+ */
+#include <simply/threading.h>
+
+#include "bench.h"
+
+#include <atomic>
+#include <thread>
+
+using bench::Clock;
+
+// The thread polls for the stop with 100us sleeps, as a worker loop would
+template <class Spawn, class Stop>
+void stop_and_join(const std::string& name, int iterations, Spawn spawn, Stop stop) {
+    bench::Samples exited(name + " stop->exit");
+    bench::Samples joined(name + " stop->joined");
+    for ( int i = 0; i < iterations; i++ ) {
+        std::atomic<bool> running{false};
+        Clock::time_point last;
+        auto thread = spawn(running, last);
+        while ( !running )
+            simply::this_thread::yield();
+        simply::this_thread::sleep_for(std::chrono::microseconds(300));
+
+        Clock::time_point begin = Clock::now();
+        stop(thread);
+        thread.join();
+        Clock::time_point end = Clock::now();
+        exited.add(begin, last);
+        joined.add(begin, end);
+    }
+    exited.report();
+    joined.report();
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 1000);
+    constexpr auto poll = std::chrono::microseconds(100);
+
+    #if SIMPLY_std20plus
+        auto loop = [poll](std::stop_token token, std::atomic<bool>& running, Clock::time_point& last){
+            running = true;
+            while ( !token.stop_requested() )
+                simply::this_thread::sleep_for(poll);
+            last = Clock::now();
+        };
+
+        stop_and_join("std::jthread", n,
+            [&loop](auto& running, auto& last){ return std::jthread(loop, std::ref(running), std::ref(last)); },
+            [](std::jthread& thread){ thread.request_stop(); }
+        );
+        stop_and_join("simply::Thread", n,
+            [&loop](auto& running, auto& last){ return simply::Thread(loop, std::ref(running), std::ref(last)); },
+            [](simply::Thread& thread){ thread.request_stop(); }
+        );
+
+        // Sleeping on the token instead, so the stop wakes the thread at once
+        auto wait = [](std::stop_token token, std::atomic<bool>& running, Clock::time_point& last){
+            running = true;
+            while ( simply::this_thread::sleep_for(std::chrono::seconds(1), token) ) {}
+            last = Clock::now();
+        };
+        stop_and_join("simply::Thread (sleep on token)", n,
+            [&wait](auto& running, auto& last){ return simply::Thread(wait, std::ref(running), std::ref(last)); },
+            [](simply::Thread& thread){ thread.request_stop(); }
+        );
+
+    #else
+        std::atomic<bool> stop{false};
+        auto loop = [poll, &stop](std::atomic<bool>& running, Clock::time_point& last){
+            running = true;
+            while ( !stop )
+                simply::this_thread::sleep_for(poll);
+            last = Clock::now();
+        };
+
+        stop_and_join("std::thread", n,
+            [&loop, &stop](auto& running, auto& last){ stop = false; return std::thread(loop, std::ref(running), std::ref(last)); },
+            [&stop](std::thread&){ stop = true; }
+        );
+        stop_and_join("simply::Thread", n,
+            [&loop, &stop](auto& running, auto& last){ stop = false; return simply::Thread(loop, std::ref(running), std::ref(last)); },
+            [&stop](simply::Thread&){ stop = true; }
+        );
+    #endif
+}
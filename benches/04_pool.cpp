@@ -0,0 +1,70 @@
+/**
+ * @file 04_pool.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Task throughput of `simply::ThreadPool`, and fan-out/fan-in of `simply::FutureThread`
+ */
+#include <simply/future_thread.h>
+#include <simply/thread_pool.h>
+
+#include "bench.h"
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+using bench::Clock;
+
+static void print_rate(const char* name, size_t tasks, Clock::duration elapsed) {
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    std::printf("%-40s %10zu tasks %9.3f ms %12.0f tasks/s\n", name, tasks, seconds * 1e3, tasks / seconds);
+}
+
+int main(int argc, char** argv) {
+    size_t n = static_cast<size_t>(bench::iterations(argc, argv, 200000));
+    std::atomic<size_t> done{0};
+
+    {
+        simply::ThreadPool pool;
+        Clock::time_point begin = Clock::now();
+        for ( size_t i = 0; i < n; i++ )
+            pool.submit([&done](){ done.fetch_add(1, std::memory_order_relaxed); });
+        pool.wait_idle();
+        print_rate("ThreadPool (external submit)", n, Clock::now() - begin);
+
+        // Submitted from inside a task, so onto a worker's own deque
+        done = 0;
+        begin = Clock::now();
+        pool.submit([&pool, &done, n](){
+            for ( size_t i = 0; i < n; i++ )
+                pool.submit([&done](){ done.fetch_add(1, std::memory_order_relaxed); });
+        });
+        pool.wait_idle();
+        print_rate("ThreadPool (nested submit)", n, Clock::now() - begin);
+    }
+
+    // A thread per task, so far fewer
+    size_t threads = std::min<size_t>(n, 1000);
+    Clock::time_point begin = Clock::now();
+    {
+        std::vector<std::future<size_t>> futures;
+        for ( size_t i = 0; i < threads; i++ )
+            futures.push_back(std::async(std::launch::async, [i](){ return i; }));
+        for ( auto& future : futures )
+            future.get();
+    }
+    print_rate("std::async", threads, Clock::now() - begin);
+
+    begin = Clock::now();
+    {
+        std::vector<simply::FutureThread<size_t>> futures;
+        for ( size_t i = 0; i < threads; i++ )
+            futures.emplace_back([i](){ return i; });
+        for ( auto& future : futures )
+            future.get();
+    }
+    print_rate("simply::FutureThread", threads, Clock::now() - begin);
+}
@@ -0,0 +1,78 @@
+/**
+ * @file 05_barrier.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Cost per phase of `simply::Barrier` against a mutex and condvar barrier (and `std::barrier` for C++ 20)
+ */
+#include <simply/sync.h>
+
+#include "bench.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#if SIMPLY_std20plus
+    #include <barrier>
+#endif
+
+using bench::Clock;
+
+// The usual generation-counting barrier
+class CondvarBarrier {
+public:
+    explicit CondvarBarrier(int expected): expected_(expected), left_(expected) {}
+
+    void arrive_and_wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if ( --left_ == 0 ) {
+            left_ = expected_;
+            generation_++;
+            cv_.notify_all();
+            return;
+        }
+        for ( unsigned generation = generation_; generation == generation_; )
+            cv_.wait(lock);
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int expected_, left_;
+    unsigned generation_ = 0;
+};
+
+// Every thread crosses the barrier `phases` times
+template <class Barrier>
+void phases(const std::string& name, int threads, int phases) {
+    Barrier barrier(threads);
+    Clock::time_point begin = Clock::now();
+    {
+        std::vector<simply::Thread> crossing;
+        for ( int t = 0; t < threads; t++ )
+            crossing.emplace_back([&barrier, phases](){
+                for ( int p = 0; p < phases; p++ )
+                    barrier.arrive_and_wait();
+            });
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+    std::printf("%-40s threads=%-3d %10.1f ns/phase\n", name.c_str(), threads, ns / phases);
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 100000);
+    unsigned cpus = simply::Thread::hardware_concurrency();
+
+    for ( int threads : {2, 4} ) {
+        if ( static_cast<unsigned>(threads) > cpus )
+            std::printf("(only %u CPUs, so %d threads must park)\n", cpus, threads);
+        phases<CondvarBarrier>("mutex + condition_variable", threads, n);
+        #if SIMPLY_std20plus
+            phases<std::barrier<>>("std::barrier", threads, n);
+        #endif
+        phases<simply::Barrier<>>("simply::Barrier", threads, n);
+    }
+}
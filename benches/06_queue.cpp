@@ -0,0 +1,84 @@
+/**
+ * @file 06_queue.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Items per second through one pipeline stage - `simply::SpscQueue`/`MpmcQueue` against a mutex-protected `std::deque`
+ */
+#include <simply/queue.h>
+
+#include "bench.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+using bench::Clock;
+
+// The usual mutex + condvar channel
+class LockedQueue {
+public:
+    void push(int value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            items_.push_back(value);
+        }
+        cv_.notify_one();
+    }
+
+    int pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this](){ return !items_.empty(); });
+        int value = items_.front();
+        items_.pop_front();
+        return value;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<int> items_;
+};
+
+static void print_rate(const char* name, size_t items, Clock::duration elapsed) {
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    std::printf("%-40s %10zu items %9.3f ms %12.0f items/s\n", name, items, seconds * 1e3, items / seconds);
+}
+
+// One producer and one consumer thread, `push(i)` and `pop()`
+template <class Queue, class Push, class Pop>
+void stage(const char* name, int n, Queue& queue, Push push, Pop pop) {
+    Clock::time_point begin = Clock::now();
+    {
+        simply::Thread consumer([&](){
+            for ( int i = 0; i < n; )
+                i += pop(queue);
+        });
+        for ( int i = 0; i < n; i++ )
+            push(queue, i);
+    }
+    print_rate(name, n, Clock::now() - begin);
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 2000000);
+
+    LockedQueue locked;
+    stage("std::deque + mutex", n, locked, [](auto& q, int i){ q.push(i); }, [](auto& q){ (void) q.pop(); return 1; });
+
+    auto spsc = std::make_unique<simply::SpscQueue<int, 1024>>();
+    stage("simply::SpscQueue", n, *spsc, [](auto& q, int i){ q.push(i); }, [](auto& q){ (void) q.pop(); return 1; });
+    stage("simply::SpscQueue (pop_n 64)", n, *spsc, [](auto& q, int i){ q.push(i); }, [](auto& q){
+        int batch[64];
+        return static_cast<int>(q.pop_n(batch, 64));
+    });
+
+    simply::MpmcQueue<int> mpmc(1024);
+    stage("simply::MpmcQueue", n, mpmc, [](auto& q, int i){ q.push(i); }, [](auto& q){ (void) q.pop(); return 1; });
+    stage("simply::MpmcQueue (pop_n 64)", n, mpmc, [](auto& q, int i){ q.push(i); }, [](auto& q){
+        int batch[64];
+        return static_cast<int>(q.pop_n(batch, 64));
+    });
+}
@@ -0,0 +1,50 @@
+/**
+ * @file 07_mutex.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Contended short critical sections - `simply::AdaptiveMutex` against `std::mutex`
+ */
+#include <simply/sync.h>
+
+#include "bench.h"
+
+#include <mutex>
+#include <vector>
+
+using bench::Clock;
+
+// Each thread takes the lock `n` times, doing a little work inside
+template <class Mutex>
+void contend(const std::string& name, int threads, int n, Mutex& mutex) {
+    volatile unsigned shared = 0;
+    Clock::time_point begin = Clock::now();
+    {
+        std::vector<simply::Thread> contenders;
+        for ( int t = 0; t < threads; t++ )
+            contenders.emplace_back([&mutex, &shared, n](){
+                for ( int i = 0; i < n; i++ ) {
+                    std::lock_guard<Mutex> lock(mutex);
+                    for ( int work = 0; work < 16; work++ )
+                        shared = shared + 1;
+                }
+            });
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+    std::printf("%-40s threads=%-3d %10.1f ns/lock\n", name.c_str(), threads, ns / (double(threads) * n));
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 200000);
+
+    for ( int threads : {1, 2, 4, 8} ) {
+        std::mutex std_mutex;
+        contend("std::mutex", threads, n, std_mutex);
+        simply::AdaptiveMutex adaptive;
+        contend("simply::AdaptiveMutex", threads, n, adaptive);
+        simply::AdaptiveMutex parking(std::chrono::nanoseconds(0));
+        contend("simply::AdaptiveMutex (no spin)", threads, n, parking);
+    }
+}
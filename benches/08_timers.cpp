@@ -0,0 +1,88 @@
+/**
+ * @file 08_timers.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Arming/cancelling many timers - `simply::TimerService` against a mutex-protected `std::multimap` - and expiry lateness
+ */
+#include <simply/timer_service.h>
+
+#include "bench.h"
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+using bench::Clock;
+
+static double ns_per(Clock::time_point begin, int n) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / n;
+}
+
+// Spread over a second, so the wheel uses several levels
+static Clock::time_point deadline_of(Clock::time_point base, int i) {
+    return base + std::chrono::microseconds((i * 7919LL) % 1000000);
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 1000000);
+
+    {
+        std::mutex mutex;
+        std::multimap<Clock::time_point, std::function<void()>> timers;
+        std::vector<std::multimap<Clock::time_point, std::function<void()>>::iterator> ids;
+        ids.reserve(n);
+        Clock::time_point base = Clock::now() + std::chrono::seconds(10);
+        Clock::time_point begin = Clock::now();
+        for ( int i = 0; i < n; i++ ) {
+            std::lock_guard<std::mutex> lock(mutex);
+            ids.push_back(timers.emplace(deadline_of(base, i), [](){}));
+        }
+        double arm = ns_per(begin, n);
+        begin = Clock::now();
+        for ( auto id : ids ) {
+            std::lock_guard<std::mutex> lock(mutex);
+            timers.erase(id);
+        }
+        std::printf("%-40s n=%-8d arm=%8.1f ns  cancel=%8.1f ns\n", "std::multimap + std::mutex", n, arm, ns_per(begin, n));
+    }
+
+    {
+        simply::TimerService timers;
+        std::vector<simply::TimerService::id_type> ids;
+        ids.reserve(n);
+        Clock::time_point base = Clock::now() + std::chrono::seconds(10);
+        Clock::time_point begin = Clock::now();
+        for ( int i = 0; i < n; i++ )
+            ids.push_back(timers.schedule_at(deadline_of(base, i), [](){}));
+        double arm = ns_per(begin, n);
+        begin = Clock::now();
+        for ( auto id : ids )
+            timers.cancel(id);
+        std::printf("%-40s n=%-8d arm=%8.1f ns  cancel=%8.1f ns\n", "simply::TimerService", n, arm, ns_per(begin, n));
+    }
+
+    // Every timer runs inline on the service thread, so the samples need no lock
+    {
+        bench::Samples lateness("TimerService expiry lateness");
+        std::atomic<int> fired{0};
+        {
+            simply::TimerService timers;
+            Clock::time_point base = Clock::now() + std::chrono::milliseconds(200);
+            for ( int i = 0; i < n; i++ ) {
+                Clock::time_point deadline = deadline_of(base, i);
+                timers.schedule_at(deadline, [&lateness, &fired, deadline](){
+                    lateness.add(deadline, Clock::now());
+                    fired.fetch_add(1, std::memory_order_release);
+                });
+            }
+            while ( fired.load(std::memory_order_acquire) < n )
+                simply::this_thread::sleep(10);
+        }
+        lateness.histogram();
+    }
+}
@@ -0,0 +1,52 @@
+/**
+ * @file 09_arena.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Small-object churn on worker threads - the thread's `simply::Arena` against the global allocator
+ */
+#include <simply/threading.h>
+
+#include "bench.h"
+
+#include <list>
+#include <memory_resource>
+#include <vector>
+
+using bench::Clock;
+
+// Each thread builds and tears down short lists of small nodes, as a request handler might
+template <class MakeList>
+void churn(const char* name, int threads, int n, const simply::Thread::Attributes& attributes, MakeList make_list) {
+    Clock::time_point begin = Clock::now();
+    {
+        std::vector<simply::Thread> workers;
+        for ( int t = 0; t < threads; t++ )
+            workers.emplace_back(attributes, [n, make_list](){
+                for ( int i = 0; i < n; i++ ) {
+                    auto list = make_list();
+                    for ( int node = 0; node < 32; node++ )
+                        list.push_back(node);
+                }
+            });
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+    std::printf("%-40s threads=%-3d %10.1f ns/node\n", name, threads, ns / (double(threads) * n * 32));
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 100000);
+    simply::Thread::Attributes with_arena;
+    with_arena.arena(simply::Arena::default_block_size);
+
+    for ( int threads : {1, 2, 4, 8} ) {
+        churn("std::list (global allocator)", threads, n, simply::Thread::Attributes(), [](){
+            return std::list<int>();
+        });
+        churn("std::pmr::list (this_thread::arena)", threads, n, with_arena, [](){
+            return std::pmr::list<int>(&simply::this_thread::arena()->resource());
+        });
+    }
+}
@@ -0,0 +1,50 @@
+/**
+ * @file 10_parallel.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Repeated loops over the same array - `simply::parallel_for` against a task per chunk on the same pool
+ */
+#include <simply/parallel.h>
+
+#include "bench.h"
+
+#include <vector>
+
+using bench::Clock;
+
+static void print_rate(const char* name, size_t elements, int rounds, Clock::duration elapsed) {
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+    std::printf("%-40s %10zu elements %8.3f ns/element %9.1f us/loop\n", name, elements, ns / (double(elements) * rounds), ns / rounds / 1e3);
+}
+
+int main(int argc, char** argv) {
+    int rounds = bench::iterations(argc, argv, 200);
+    simply::ThreadPool pool;
+    constexpr size_t grain = 4096;
+
+    for ( size_t n : {size_t(1) << 14, size_t(1) << 18, size_t(1) << 22} ) {
+        std::vector<float> data(n, 1.0f);
+
+        // One task per chunk, chunks land on whichever worker is free
+        Clock::time_point begin = Clock::now();
+        for ( int r = 0; r < rounds; r++ ) {
+            for ( size_t chunk = 0; chunk < n; chunk += grain )
+                pool.submit([&data, chunk, n](){
+                    for ( size_t i = chunk; i < std::min(n, chunk + grain); i++ )
+                        data[i] = data[i] * 0.5f + 1.0f;
+                });
+            pool.wait_idle();
+        }
+        print_rate("ThreadPool::submit per chunk", n, rounds, Clock::now() - begin);
+
+        begin = Clock::now();
+        for ( int r = 0; r < rounds; r++ )
+            simply::parallel_for(pool, size_t(0), n, grain, [&data](size_t i){
+                data[i] = data[i] * 0.5f + 1.0f;
+            });
+        print_rate("parallel_for", n, rounds, Clock::now() - begin);
+    }
+}
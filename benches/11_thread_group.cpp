@@ -0,0 +1,63 @@
+/**
+ * @file 11_thread_group.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Stopping many workers that take a while to shut down - one join at a time against `simply::ThreadGroup`
+ */
+#include <simply/thread_group.h>
+
+#include "bench.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using bench::Clock;
+
+static void print_time(const char* name, int threads, Clock::duration elapsed) {
+    std::printf("%-40s threads=%-4d %9.3f ms\n", name, threads, std::chrono::duration<double, std::milli>(elapsed).count());
+}
+
+// Polls for its stop, then spends `shutdown` flushing before it exits
+template <class Stopped>
+static void worker(Stopped stopped, int shutdown_ms) {
+    while ( !stopped() )
+        simply::this_thread::sleep(1);
+    simply::this_thread::sleep(shutdown_ms);
+}
+
+int main(int argc, char** argv) {
+    int shutdown_ms = bench::iterations(argc, argv, 2);
+
+    for ( int n : {16, 64, 256} ) {
+        // Each stopped just before its join, as Thread::join does
+        {
+            std::unique_ptr<std::atomic<bool>[]> stop(new std::atomic<bool>[n]());
+            std::vector<simply::Thread> threads;
+            for ( int i = 0; i < n; i++ )
+                threads.emplace_back([&stop, i, shutdown_ms](){
+                    worker([&stop, i](){ return stop[i].load(); }, shutdown_ms);
+                });
+            Clock::time_point begin = Clock::now();
+            for ( int i = 0; i < n; i++ ) {
+                stop[i] = true;
+                threads[i].join();
+            }
+            print_time("Thread::join one at a time", n, Clock::now() - begin);
+        }
+
+        {
+            std::atomic<bool> stop{false};
+            simply::ThreadGroup group(n, simply::Thread::Attributes(), [&stop, shutdown_ms](){
+                worker([&stop](){ return stop.load(); }, shutdown_ms);
+            });
+            Clock::time_point begin = Clock::now();
+            stop = true;
+            group.join_all();
+            print_time("ThreadGroup::join_all", n, Clock::now() - begin);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+/**
+ * @file 12_per_thread.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Counting from many threads - one shared atomic, against a `simply::PerThread` slot each
+ */
+#include <simply/per_thread.h>
+
+#include "bench.h"
+
+#include <atomic>
+#include <vector>
+
+using bench::Clock;
+
+template <class Count>
+void run(const char* name, int threads, int n, Count count) {
+    Clock::time_point begin = Clock::now();
+    {
+        std::vector<simply::Thread> workers;
+        for ( int t = 0; t < threads; t++ )
+            workers.emplace_back([n, &count](){
+                for ( int i = 0; i < n; i++ )
+                    count();
+            });
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+    std::printf("%-40s threads=%-3d %8.2f ns/increment\n", name, threads, ns / (double(threads) * n));
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 10000000);
+    for ( int threads : {1, 2, 4, 8} ) {
+        std::atomic<uint64_t> shared{0};
+        run("std::atomic fetch_add (shared)", threads, n, [&shared](){
+            shared.fetch_add(1, std::memory_order_relaxed);
+        });
+
+        simply::PerThread<std::atomic<uint64_t>> per_thread;
+        run("PerThread::add", threads, n, [&per_thread](){
+            per_thread.add(1);
+        });
+        if ( shared.load() != per_thread.sum() )
+            std::printf("Totals differ!\n");
+    }
+}
@@ -0,0 +1,49 @@
+/**
+ * @file 13_trace.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Cost of recording a `simply::Trace` event, and of writing the trace out
+ */
+#define SIMPLY_TRACE 1
+#include <simply/threading.h>
+
+#include "bench.h"
+
+#include <sstream>
+#include <vector>
+
+using bench::Clock;
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 10000000);
+
+    for ( int threads : {1, 4} ) {
+        Clock::time_point begin = Clock::now();
+        {
+            std::vector<simply::Thread> workers;
+            for ( int t = 0; t < threads; t++ )
+                workers.emplace_back([n](){
+                    for ( int i = 0; i < n; i++ )
+                        SIMPLY_TRACE_INSTANT("event");
+                });
+        }
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+        std::printf("%-40s threads=%-3d %8.2f ns/event\n", "SIMPLY_TRACE_INSTANT", threads, ns / (double(threads) * n));
+
+        begin = Clock::now();
+        for ( int i = 0; i < n; i++ ) {
+            SIMPLY_TRACE_SCOPE("span");
+        }
+        ns = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+        std::printf("%-40s threads=%-3d %8.2f ns/event\n", "SIMPLY_TRACE_SCOPE (begin + end)", 1, ns / (2.0 * n));
+    }
+
+    std::ostringstream out;
+    Clock::time_point begin = Clock::now();
+    simply::Trace::write(out);
+    std::printf("%-40s %zu bytes %9.3f ms\n", "Trace::write", out.str().size(),
+        std::chrono::duration<double, std::milli>(Clock::now() - begin).count());
+}
@@ -0,0 +1,50 @@
+/**
+ * @file 14_realtime.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * The first pass of a thread over its stack - as started, against started with `prefault_stack`
+ */
+#include <simply/threading.h>
+
+#include "bench.h"
+
+#include <cstdint>
+#include <string>
+
+using bench::Clock;
+
+constexpr size_t depth = 256 * 1024;
+
+// A call chain using `depth` bytes of stack, in one frame
+SIMPLY_NOINLINE static char deep_call() {
+    volatile char frame[depth];
+    for ( size_t at = 0; at < depth; at += 64 )
+        frame[at] = 1;
+    return frame[0];
+}
+
+void run(const char* name, int n, size_t prefault) {
+    bench::Samples first(std::string(name) + " first call");
+    uint64_t faults = 0;
+    for ( int i = 0; i < n; i++ ) {
+        simply::Thread thread(simply::Thread::Attributes().prefault_stack(prefault), [&first, &faults](){
+            simply::this_thread::stats();
+            uint64_t before = simply::this_thread::stats().minor_faults;
+            Clock::time_point begin = Clock::now();
+            deep_call();
+            first.add(begin, Clock::now());
+            faults += simply::this_thread::stats().minor_faults - before;
+        });
+    }
+    first.report();
+    std::printf("%-40s %8.2f faults/thread\n", name, double(faults) / n);
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 200);
+    run("Thread", n, 0);
+    run("Thread, prefault_stack", n, depth + 64 * 1024);
+}
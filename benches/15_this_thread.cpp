@@ -0,0 +1,48 @@
+/**
+ * @file 15_this_thread.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * `this_thread` getters as called from a logging hot path - the OS call each time, against the cached block
+ */
+#include <simply/threading.h>
+
+#include "bench.h"
+
+#include <string>
+
+using bench::Clock;
+
+template <class Get>
+void run(const char* name, int n, Get get) {
+    size_t sink = 0;
+    Clock::time_point begin = Clock::now();
+    for ( int i = 0; i < n; i++ )
+        sink += get();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+    std::printf("%-40s %8.2f ns/call%s\n", name, ns / n, sink == 1 ? " " : "");
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 1000000);
+    simply::Thread(simply::Thread::Attributes().name("logger"), [n](){
+        #if SIMPLY_LINUX
+            run("pthread_getname_np", n, [](){
+                char name[16];
+                pthread_getname_np(pthread_self(), name, sizeof(name));
+                return size_t(name[0]);
+            });
+            run("sched_getaffinity", n, [](){
+                cpu_set_t set;
+                sched_getaffinity(0, sizeof(set), &set);
+                return size_t(CPU_COUNT(&set));
+            });
+        #endif
+        run("this_thread::get_name", n, [](){ return simply::this_thread::get_name().size(); });
+        run("this_thread::get_id", n, [](){ return size_t(simply::this_thread::get_id() == simply::Thread::id()); });
+        run("this_thread::get_affinity", n, [](){ return simply::this_thread::get_affinity().count(); });
+        run("this_thread::get_priority", n, [](){ return size_t(simply::this_thread::get_priority()); });
+    }).join();
+}
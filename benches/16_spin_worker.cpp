@@ -0,0 +1,76 @@
+/**
+ * @file 16_spin_worker.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Handoff latency to a consumer - parked in `SpscQueue::pop`, against a `simply::SpinWorker` polling `try_pop`
+ */
+#include <simply/spin_worker.h>
+#include <simply/queue.h>
+
+#include "bench.h"
+
+#include <atomic>
+
+using bench::Clock;
+
+using Queue = simply::SpscQueue<Clock::time_point, 1024>;
+
+// Sends `n` timestamps a little apart, so the consumer catches up - and parks - between them
+template <class Received>
+void send(int n, Queue& queue, Received& received) {
+    for ( int i = 0; i < n; i++ ) {
+        while ( !queue.try_push(Clock::now()) )
+            simply::this_thread::relax();
+        while ( received.load(std::memory_order_acquire) <= i )
+            simply::this_thread::relax();
+        simply::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 2000);
+    simply::CpuSet allowed = simply::this_thread::get_affinity();
+    if ( allowed.count() < 2 ) {
+        std::printf("Needs 2 CPUs, one to spin on\n");
+        return 0;
+    }
+    size_t spin_cpu = allowed.first();
+    allowed.reset(spin_cpu);
+    simply::this_thread::set_affinity(allowed);
+
+    {
+        bench::Samples latency("SpscQueue::pop (parked)");
+        Queue queue;
+        std::atomic<int> received{0};
+        simply::Thread consumer(simply::Thread::Attributes().affinity(simply::CpuSet({spin_cpu})), [&](){
+            for ( int i = 0; i < n; i++ ) {
+                Clock::time_point sent = queue.pop();
+                latency.add(sent, Clock::now());
+                received.store(i + 1, std::memory_order_release);
+            }
+        });
+        send(n, queue, received);
+        consumer.join();
+        latency.report();
+    }
+
+    {
+        bench::Samples latency("SpinWorker try_pop");
+        Queue queue;
+        std::atomic<int> received{0};
+        simply::SpinWorker consumer(spin_cpu, simply::SpinWorker::ANY, [&](){
+            Clock::time_point sent;
+            if ( !queue.try_pop(sent) )
+                return false;
+            latency.add(sent, Clock::now());
+            received.fetch_add(1, std::memory_order_release);
+            return true;
+        });
+        send(n, queue, received);
+        consumer.join();
+        latency.report();
+    }
+}
@@ -0,0 +1,38 @@
+/**
+ * @file 17_qos.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Sleep overshoot of a thread under each `Thread::QoS` - the price of coalesced wakeups
+ */
+#include <simply/threading.h>
+
+#include "bench.h"
+
+#include <string>
+
+using bench::Clock;
+using simply::Thread;
+
+void run(const char* name, int n, Thread::QoS qos) {
+    bench::Samples late(std::string(name) + " sleep_for 200us");
+    Thread(Thread::Attributes().qos(qos), [&late, n](){
+        for ( int i = 0; i < n; i++ ) {
+            Clock::time_point deadline = Clock::now() + std::chrono::microseconds(200);
+            simply::this_thread::sleep_for(std::chrono::microseconds(200));
+            late.add(deadline, Clock::now());
+        }
+    }).join();
+    late.histogram();
+}
+
+int main(int argc, char** argv) {
+    int n = bench::iterations(argc, argv, 1000);
+
+    run("LATENCY", n, Thread::QoS::LATENCY);
+    run("DEFAULT", n, Thread::QoS::DEFAULT);
+    run("EFFICIENCY", n, Thread::QoS::EFFICIENCY);
+    run("BACKGROUND", n, Thread::QoS::BACKGROUND);
+}
@@ -0,0 +1,93 @@
+/**
+ * @file bench.h
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Minimal timing helpers shared by the benchmarks - no dependencies beyond the standard library
+ */
+#ifndef SIMPLY_BENCH_H_
+#define SIMPLY_BENCH_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+    using Clock = std::chrono::steady_clock;
+
+    ///   iterations
+    /// @brief First command line argument, or `fallback`
+    inline int iterations(int argc, char** argv, int fallback) {
+        if ( argc > 1 ) {
+            int n = std::atoi(argv[1]);
+            if ( n > 0 )
+                return n;
+        }
+        return fallback;
+    }
+
+    ///   Samples
+    /// @brief Collects durations, and prints their distribution
+    class Samples {
+    public:
+        explicit Samples(std::string name): name_(std::move(name)) {}
+
+        void add(Clock::duration sample) {
+            ns_.push_back(std::chrono::duration<double, std::nano>(sample).count());
+        }
+
+        void add(Clock::time_point from, Clock::time_point to) {
+            add(to - from);
+        }
+
+        ///   report
+        /// @brief One line of min/median/p90/p99/max in microseconds
+        void report() {
+            if ( ns_.empty() )
+                return;
+            std::sort(ns_.begin(), ns_.end());
+            std::printf("%-40s n=%-7zu min=%9.2f p50=%9.2f p90=%9.2f p99=%9.2f max=%9.2f us\n",
+                name_.c_str(), ns_.size(),
+                ns_.front() / 1e3, at(0.50) / 1e3, at(0.90) / 1e3, at(0.99) / 1e3, ns_.back() / 1e3
+            );
+        }
+
+        ///   histogram
+        /// @brief Counts per power-of-two bucket of microseconds, after the report
+        void histogram() {
+            report();
+            std::vector<size_t> buckets;
+            for ( double ns : ns_ ) {
+                size_t bucket = 0;
+                for ( double us = ns / 1e3; us >= 1 && bucket < 24; us /= 2 )
+                    bucket++;
+                if ( buckets.size() <= bucket )
+                    buckets.resize(bucket + 1);
+                buckets[bucket]++;
+            }
+            for ( size_t b = 0; b < buckets.size(); b++ ) {
+                if ( !buckets[b] )
+                    continue;
+                double pct = 100.0 * buckets[b] / ns_.size();
+                std::printf("    < %8zu us %7zu %6.2f%% %s\n",
+                    size_t(1) << b, buckets[b], pct, std::string(static_cast<size_t>(pct / 2), '#').c_str());
+            }
+        }
+
+    private:
+        double at(double quantile) const {
+            return ns_[std::min(ns_.size() - 1, static_cast<size_t>(quantile * ns_.size()))];
+        }
+
+        std::string name_;
+        std::vector<double> ns_;
+    };
+}
+
+#endif // SIMPLY_BENCH_H_
@@ -0,0 +1,487 @@
+/**
+ * @file coroutine.h
+ * @brief simply-threading: C++ 20 coroutines - `simply::Task`, and awaiting pools and timers instead of blocking threads
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_COROUTINE_H_
+#define SIMPLY_COROUTINE_H_
+
+#include "timer_service.h"
+
+// Coroutines need C++ 20 - for C++ 17 this header is empty
+#if SIMPLY_std20plus
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace simply {
+    // =================================================================
+    // >> Task
+    // =================================================================
+    template <class T = void>
+    class Task;
+
+    ///   _TaskPromiseBase {internal}
+    /// @brief What every Task's promise has - who awaits it, its stop_token, and its exception
+    struct _TaskPromiseBase {
+        struct _FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+
+            template <class Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept;
+
+            void await_resume() const noexcept {}
+        };
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        _FinalAwaiter final_suspend() const noexcept { return {}; }
+        void unhandled_exception() noexcept { error = std::current_exception(); }
+
+        std::coroutine_handle<> continuation;
+        std::stop_token token;
+        std::exception_ptr error;
+    };
+
+    ///   _TaskPromise {internal}
+    template <class T>
+    struct _TaskPromise: _TaskPromiseBase {
+        Task<T> get_return_object() noexcept;
+
+        template <class U = T>
+        void return_value(U&& value) { result.emplace(std::forward<U>(value)); }
+
+        T take();
+
+        std::optional<T> result;
+    };
+
+    template <>
+    struct _TaskPromise<void>: _TaskPromiseBase {
+        Task<void> get_return_object() noexcept;
+
+        void return_void() const noexcept {}
+
+        void take();
+    };
+
+    ///   Task {C++ std >= 20}
+    /// @brief A lazily started coroutine returning a T, run by awaiting it
+    ///
+    /// `co_await`ing a Task starts it on the awaiting thread, resuming the
+    /// awaiter when it finishes - with its result, or rethrowing its
+    /// exception. A Task awaited by another inherits its stop_token, so one
+    /// `request_stop` reaches every sleep down the chain. The outermost Task
+    /// is run by `sync_wait` or `spawn`.
+    template <class T>
+    class Task {
+    public:
+        static_assert(!std::is_reference_v<T>, "Task cannot return a reference...");
+
+        using promise_type = _TaskPromise<T>;
+
+        /* === Constructors/Destructor === ========================== */
+        ///   Default Constructor
+        /// @brief A Task with no coroutine
+        Task() noexcept = default;
+
+        ///   Destructor
+        /// @brief Destroys the coroutine, which must not be running
+        ~Task();
+
+        ///   Single-Ownership
+        Task(Task&& other) noexcept;
+        Task& operator=(Task&& other) noexcept;
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        /* === Control/Operations === =============================== */
+        ///   co_await
+        /// @brief Run the Task to its end, then resume with its result
+        auto operator co_await() && noexcept;
+
+        /* === Observers === ======================================== */
+        ///   valid
+        /// @brief If this holds a coroutine
+        bool valid() const noexcept;
+
+        ///   done
+        /// @brief If the coroutine has finished
+        bool done() const noexcept;
+
+    private:
+        friend promise_type;
+
+        template <class U>
+        friend U sync_wait(Task<U> task, std::stop_token token);
+
+        friend void spawn(Task<void> task, std::stop_token token);
+
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept;
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    ///   sync_wait {blocking} {C++ std >= 20}
+    /// @brief Run `task` to its end on this thread and wherever it moves itself, and return its result
+    /// @throws
+    ///  - Whatever `task` threw
+    template <class T>
+    T sync_wait(Task<T> task, std::stop_token token = {});
+
+    ///   spawn {C++ std >= 20}
+    /// @brief Start `task` on this thread, returning at its first suspension
+    ///
+    /// Nothing waits for it, so anything it uses must outlive it. As for
+    /// `Thread`, an exception escaping `task` terminates the program.
+    void spawn(Task<void> task, std::stop_token token = {});
+
+    namespace this_task {
+        ///   get_stop_token {C++ std >= 20}
+        /// @brief `co_await this_task::get_stop_token()` gives the running Task's stop_token
+        auto get_stop_token() noexcept;
+    }
+
+    // =================================================================
+    // >> Awaitables
+    // =================================================================
+    ///   resume_on {C++ std >= 20}
+    /// @brief `co_await resume_on(pool)` continues the coroutine on one of `pool`'s workers
+    auto resume_on(ThreadPool& pool) noexcept;
+
+    ///   sleep_until {C++ std >= 20}
+    /// @brief `co_await sleep_until(timers, abs_time)` suspends until `abs_time`, without blocking a thread
+    ///
+    /// Resumes on the same ThreadPool if suspended from one of its workers,
+    /// otherwise on the thread of `timers` - or of whichever requested the
+    /// stop. Wakes early once a stop is requested on the awaiting Task's token.
+    /// @returns `false` if a stop was requested
+    auto sleep_until(TimerService& timers, std::chrono::steady_clock::time_point abs_time);
+
+    ///   sleep_until {C++ std >= 20}
+    /// @brief As above, on a TimerService shared by every coroutine
+    auto sleep_until(std::chrono::steady_clock::time_point abs_time);
+
+    ///   sleep_for {C++ std >= 20}
+    /// @brief `co_await sleep_for(timers, rel_time)` - see sleep_until
+    /// @throws
+    ///  - system_error(invalid_argument) if `rel_time` is negative
+    auto sleep_for(TimerService& timers, std::chrono::nanoseconds rel_time);
+
+    ///   sleep_for {C++ std >= 20}
+    /// @brief As above, on a TimerService shared by every coroutine
+    /// @throws
+    ///  - system_error(invalid_argument) if `rel_time` is negative
+    auto sleep_for(std::chrono::nanoseconds rel_time);
+}
+
+// =====================================================================
+// >> Implementations
+// =====================================================================
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Task
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // Hands the thread straight to whoever awaits the Task
+    template <class Promise>
+    std::coroutine_handle<> _TaskPromiseBase::_FinalAwaiter::await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+        std::coroutine_handle<> continuation = handle.promise().continuation;
+        return continuation ? continuation : std::noop_coroutine();
+    }
+
+    template <class T>
+    Task<T> _TaskPromise<T>::get_return_object() noexcept {
+        return Task<T>(std::coroutine_handle<_TaskPromise<T>>::from_promise(*this));
+    }
+
+    template <class T>
+    T _TaskPromise<T>::take() {
+        if ( error )
+            std::rethrow_exception(error);
+        return std::move(*result);
+    }
+
+    inline Task<void> _TaskPromise<void>::get_return_object() noexcept {
+        return Task<void>(std::coroutine_handle<_TaskPromise<void>>::from_promise(*this));
+    }
+
+    inline void _TaskPromise<void>::take() {
+        if ( error )
+            std::rethrow_exception(error);
+    }
+
+    template <class T>
+    Task<T>::Task(std::coroutine_handle<promise_type> handle) noexcept: handle_(handle) {}
+
+    template <class T>
+    Task<T>::~Task() {
+        if ( handle_ )
+            handle_.destroy();
+    }
+
+    template <class T>
+    Task<T>::Task(Task&& other) noexcept: handle_(std::exchange(other.handle_, nullptr)) {}
+
+    template <class T>
+    Task<T>& Task<T>::operator=(Task&& other) noexcept {
+        if ( this != &other ) {
+            if ( handle_ )
+                handle_.destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ///   _TaskAwaiter {internal}
+    /// @brief Starts the Task, passing on the awaiter's stop_token, and later gives its result
+    template <class T>
+    struct _TaskAwaiter {
+        std::coroutine_handle<_TaskPromise<T>> handle;
+
+        bool await_ready() const noexcept { return !handle || handle.done(); }
+
+        template <class Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            if constexpr ( std::is_base_of_v<_TaskPromiseBase, Promise> )
+                if ( !handle.promise().token.stop_possible() )
+                    handle.promise().token = awaiting.promise().token;
+            return handle;
+        }
+
+        T await_resume() {
+            if ( !handle )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "Task: Awaited without a coroutine!"
+                );
+            return handle.promise().take();
+        }
+    };
+
+    template <class T>
+    auto Task<T>::operator co_await() && noexcept {
+        return _TaskAwaiter<T>{handle_};
+    }
+
+    template <class T>
+    bool Task<T>::valid() const noexcept {
+        return static_cast<bool>(handle_);
+    }
+
+    template <class T>
+    bool Task<T>::done() const noexcept {
+        return handle_ && handle_.done();
+    }
+
+    ///   _Detached {internal}
+    /// @brief Eagerly started coroutine which frees itself at its end - the root of sync_wait/spawn
+    struct _Detached {
+        struct promise_type {
+            _Detached get_return_object() const noexcept { return {}; }
+            std::suspend_never initial_suspend() const noexcept { return {}; }
+            std::suspend_never final_suspend() const noexcept { return {}; }
+            void return_void() const noexcept {}
+            void unhandled_exception() const noexcept { std::terminate(); }
+        };
+    };
+
+    ///   _TaskStart {internal}
+    /// @brief Runs a Task from a root coroutine, leaving its result in the promise
+    template <class Promise>
+    struct _TaskStart {
+        std::coroutine_handle<Promise> handle;
+
+        bool await_ready() const noexcept { return false; }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    template <class T>
+    T sync_wait(Task<T> task, std::stop_token token) {
+        if ( !task.handle_ )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "sync_wait: Task has no coroutine!"
+            );
+        task.handle_.promise().token = std::move(token);
+        Event done;
+        [](std::coroutine_handle<_TaskPromise<T>> handle, Event& done) -> _Detached {
+            co_await _TaskStart<_TaskPromise<T>>{handle};
+            done.set();
+        }(task.handle_, done);
+        done.wait();
+        return task.handle_.promise().take();
+    }
+
+    inline void spawn(Task<void> task, std::stop_token token) {
+        if ( !task.handle_ )
+            return;
+        task.handle_.promise().token = std::move(token);
+        // The root frame owns `task`, so both go once it finishes
+        [](Task<void> task) -> _Detached {
+            co_await _TaskStart<_TaskPromise<void>>{task.handle_};
+            task.handle_.promise().take();
+        }(std::move(task));
+    }
+
+    // Reads the token off the promise, without suspending
+    struct _StopTokenAwaiter {
+        std::stop_token token;
+
+        bool await_ready() const noexcept { return false; }
+
+        template <class Promise>
+        bool await_suspend(std::coroutine_handle<Promise> awaiting) noexcept {
+            static_assert(std::is_base_of_v<_TaskPromiseBase, Promise>, "get_stop_token must be awaited from a Task...");
+            token = awaiting.promise().token;
+            return false;
+        }
+
+        std::stop_token await_resume() noexcept { return std::move(token); }
+    };
+
+    inline auto this_task::get_stop_token() noexcept {
+        return _StopTokenAwaiter{};
+    }
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Awaitables
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    struct _ResumeOnAwaiter {
+        ThreadPool& pool;
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> awaiting) {
+            pool.submit([awaiting](){ awaiting.resume(); });
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    inline auto resume_on(ThreadPool& pool) noexcept {
+        return _ResumeOnAwaiter{pool};
+    }
+
+    inline TimerService& _coroutine_timers() {
+        static TimerService timers("coroutines");
+        return timers;
+    }
+
+    ///   _SleepState {internal}
+    /// @brief Shared by a sleeping coroutine, its timer and its stop_callback
+    ///
+    /// Timer and stop race to `claimed`, and the coroutine is resumed by
+    /// whichever of the winner and the suspending thread comes last to
+    /// `pending` - so it never resumes before it has finished suspending.
+    struct _SleepState {
+        std::coroutine_handle<> handle;
+        ThreadPool* pool;
+        TimerService* timers;
+        TimerService::id_type id = 0;
+        std::atomic<bool> claimed{false};
+        std::atomic<int> pending{2};
+        bool stopped = false;
+
+        void finish() {
+            if ( pending.fetch_sub(1, std::memory_order_acq_rel) != 1 )
+                return;
+            if ( pool )
+                pool->submit([handle = handle](){ handle.resume(); });
+            else
+                handle.resume();
+        }
+    };
+
+    struct _SleepStop {
+        std::shared_ptr<_SleepState> state;
+
+        void operator()() const {
+            if ( state->claimed.exchange(true, std::memory_order_acq_rel) )
+                return;
+            state->stopped = true;
+            state->timers->cancel(state->id);
+            state->finish();
+        }
+    };
+
+    struct _SleepAwaiter {
+        TimerService& timers;
+        std::chrono::steady_clock::time_point abs_time;
+        std::shared_ptr<_SleepState> state;
+        std::optional<std::stop_callback<_SleepStop>> on_stop;
+        bool stopped = false;
+
+        bool await_ready() const noexcept { return false; }
+
+        template <class Promise>
+        bool await_suspend(std::coroutine_handle<Promise> awaiting) {
+            std::stop_token token;
+            if constexpr ( std::is_base_of_v<_TaskPromiseBase, Promise> )
+                token = awaiting.promise().token;
+            if ( token.stop_requested() ) {
+                stopped = true;
+                return false;
+            }
+            state = std::make_shared<_SleepState>();
+            state->handle = awaiting;
+            state->pool = ThreadPool::current();
+            state->timers = &timers;
+            state->id = timers.schedule_at(abs_time, [state = state](){
+                if ( !state->claimed.exchange(true, std::memory_order_acq_rel) )
+                    state->finish();
+            });
+            if ( token.stop_possible() )
+                on_stop.emplace(token, _SleepStop{state});
+            // Last here, so carry on without suspending at all
+            return state->pending.fetch_sub(1, std::memory_order_acq_rel) != 1;
+        }
+
+        bool await_resume() noexcept {
+            return !(stopped || (state && state->stopped));
+        }
+    };
+
+    inline auto sleep_until(TimerService& timers, std::chrono::steady_clock::time_point abs_time) {
+        return _SleepAwaiter{timers, abs_time, nullptr, std::nullopt};
+    }
+
+    inline auto sleep_until(std::chrono::steady_clock::time_point abs_time) {
+        return sleep_until(_coroutine_timers(), abs_time);
+    }
+
+    inline auto sleep_for(TimerService& timers, std::chrono::nanoseconds rel_time) {
+        if ( rel_time.count() < 0 )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "sleep_for: Value was negative!"
+            );
+        return sleep_until(timers, _steady_deadline(rel_time));
+    }
+
+    inline auto sleep_for(std::chrono::nanoseconds rel_time) {
+        return sleep_for(_coroutine_timers(), rel_time);
+    }
+}
+
+#endif // SIMPLY_std20plus
+
+#endif // SIMPLY_COROUTINE_H_
@@ -0,0 +1,335 @@
+/**
+ * @file future_thread.h
+ * @brief simply-threading: `simply::Thread` returning its result, without a separate shared state
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_FUTURE_THREAD_H_
+#define SIMPLY_FUTURE_THREAD_H_
+
+#include "threading.h"
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace simply {
+    // =================================================================
+    // >> FutureThread
+    // =================================================================
+    ///   _FutureValue {internal}
+    /// @brief Result slot, holding an R, a reference, or nothing for void
+    template <class R>
+    struct _FutureValue {
+        std::optional<R> value;
+
+        template <class Call>
+        void set(Call&& call) { value.emplace(std::forward<Call>(call)()); }
+
+        R take() { return std::move(*value); }
+    };
+
+    template <class R>
+    struct _FutureValue<R&> {
+        R* value = nullptr;
+
+        template <class Call>
+        void set(Call&& call) { value = &std::forward<Call>(call)(); }
+
+        R& take() noexcept { return *value; }
+    };
+
+    template <>
+    struct _FutureValue<void> {
+        template <class Call>
+        void set(Call&& call) { std::forward<Call>(call)(); }
+
+        void take() noexcept {}
+    };
+
+    ///   _FutureState {internal}
+    /// @brief What a FutureThread owns - the task fills this in, then sets `ready`
+    template <class R>
+    struct _FutureState {
+        virtual ~_FutureState() = default;
+
+        std::atomic<uint32_t> ready{0};
+        std::exception_ptr error;
+        _FutureValue<R> value;
+    };
+
+    ///   _FutureTask {internal}
+    /// @brief The state together with the function and arguments, in one allocation
+    template <class R, class F, class... Args>
+    struct _FutureTask: _FutureState<R> {
+        #if SIMPLY_std20plus
+            static constexpr bool stoppable = std::is_invocable_v<std::decay_t<F>, std::stop_token, std::decay_t<Args>...>;
+        #else
+            static constexpr bool stoppable = false;
+        #endif
+
+        std::tuple<std::decay_t<F>, std::decay_t<Args>...> payload;
+
+        template <class G, class... A>
+        explicit _FutureTask(G&& f, A&&... args): payload(std::forward<G>(f), std::forward<A>(args)...) {}
+
+        // `token` is the thread's stop_token, if F takes one
+        template <class... Token>
+        void run(Token&&... token) noexcept {
+            try {
+                this->value.set([&]() -> R {
+                    return std::apply([&](auto& f, auto&... args) -> R {
+                        return std::invoke(std::move(f), std::forward<Token>(token)..., std::move(args)...);
+                    }, payload);
+                });
+            }
+            catch ( ... ) {
+                this->error = std::current_exception();
+            }
+            this->ready.store(1, std::memory_order_release);
+            _futex_wake_all(this->ready);
+        }
+    };
+
+    #if SIMPLY_std20plus
+        template <class F, class... Args>
+        using _future_result_t = typename std::conditional_t<
+            std::is_invocable_v<std::decay_t<F>, std::stop_token, std::decay_t<Args>...>,
+            std::invoke_result<std::decay_t<F>, std::stop_token, std::decay_t<Args>...>,
+            std::invoke_result<std::decay_t<F>, std::decay_t<Args>...>
+        >::type;
+
+    #else
+        template <class F, class... Args>
+        using _future_result_t = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+    #endif
+
+    ///   FutureThread
+    /// @brief A `simply::Thread` whose function's result (or exception) is kept for `get`
+    ///
+    /// The function, its arguments, the result and the ready flag share a
+    /// single allocation, and waiting is on that flag, so there is no
+    /// separate promise/future state with its own mutex and condvar.
+    ///
+    /// Like Thread, the destructor joins.
+    template <class R>
+    class FutureThread {
+    public:
+        /* === Constructors/Destructor === ========================== */
+        ///   Default constructor
+        /// @brief No thread and no result
+        FutureThread() noexcept = default;
+
+        ///   Constructor
+        /// @brief Run `f(args...)` on a new thread
+        /// @throws
+        ///  - system_error if system API calls failed
+        template <class F, class... Args, std::enable_if_t<!_is_thread_option<F>::value, int> = 0>
+        explicit FutureThread(F&& f, Args&&... args);
+
+        ///   Constructor {attributes}
+        /// @brief Run `f(args...)` on a new thread started with `attributes`
+        /// @throws
+        ///  - system_error if system API calls failed
+        template <class F, class... Args>
+        FutureThread(const Thread::Attributes& attributes, F&& f, Args&&... args);
+
+        FutureThread(const FutureThread&) = delete;
+        FutureThread& operator=(const FutureThread&) = delete;
+
+        ///   Move Constructor
+        FutureThread(FutureThread&& other) noexcept = default;
+
+        ///   Move Assignment {blocking}
+        /// @brief If this has a running thread, will join it
+        FutureThread& operator=(FutureThread&& other);
+
+        /* === Observers === ======================================== */
+        ///   valid
+        /// @brief Check if there is a result to `get`
+        bool valid() const noexcept;
+
+        ///   ready
+        /// @brief Check if the result is available, so `get` won't block
+        bool ready() const noexcept;
+
+        ///   thread
+        /// @brief The thread running the function, such as for naming or stopping it
+        Thread& thread() noexcept;
+
+        const Thread& thread() const noexcept;
+
+        /* === Control/Operations === =============================== */
+        ///   wait {blocking}
+        /// @brief Block until the result is available
+        /// @throws
+        ///  - system_error(invalid_argument) if not valid
+        void wait() const;
+
+        ///   wait_for {timed}
+        /// @brief Returns `true` if the result became available within `timeout_duration`
+        /// @throws
+        ///  - system_error(invalid_argument) if not valid
+        template <class Rep, class Period>
+        bool wait_for(const std::chrono::duration<Rep, Period>& timeout_duration) const;
+
+        ///   wait_until {timed}
+        /// @brief Returns `true` if the result became available by `timeout_time`
+        /// @throws
+        ///  - system_error(invalid_argument) if not valid
+        template <class Clock, class Duration>
+        bool wait_until(const std::chrono::time_point<Clock, Duration>& timeout_time) const;
+
+        ///   get {blocking}
+        /// @brief Wait for, then take, the result - rethrowing if the function threw
+        ///
+        /// Afterwards this is no longer valid, though the thread is only
+        /// joined by the destructor (or `thread().join()`)
+        /// @throws
+        ///  - system_error(invalid_argument) if not valid
+        ///  - Whatever the function threw
+        R get();
+
+    private:
+        void _ensure_valid(const char* called_from) const;
+
+        template <class Task>
+        static Thread _launch(const Thread::Attributes& attributes, Task* task);
+
+        // Declared first, so the thread is joined before this is freed
+        std::unique_ptr<_FutureState<R>> state_;
+        Thread thread_;
+    };
+
+    template <class F, class... Args, std::enable_if_t<!_is_thread_option<F>::value, int> = 0>
+    FutureThread(F&&, Args&&...) -> FutureThread<_future_result_t<F, Args...>>;
+
+    template <class F, class... Args>
+    FutureThread(const Thread::Attributes&, F&&, Args&&...) -> FutureThread<_future_result_t<F, Args...>>;
+}
+
+// =====================================================================
+// >> Implementations
+// =====================================================================
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ FutureThread
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    template <class R>
+    template <class F, class... Args, std::enable_if_t<!_is_thread_option<F>::value, int>>
+    FutureThread<R>::FutureThread(F&& f, Args&&... args):
+        FutureThread(Thread::Attributes(), std::forward<F>(f), std::forward<Args>(args)...)
+    {}
+
+    template <class R>
+    template <class F, class... Args>
+    FutureThread<R>::FutureThread(const Thread::Attributes& attributes, F&& f, Args&&... args) {
+        using Task = _FutureTask<R, F, Args...>;
+        auto task = std::make_unique<Task>(std::forward<F>(f), std::forward<Args>(args)...);
+        thread_ = _launch(attributes, task.get());
+        state_ = std::move(task);
+    }
+
+    template <class R>
+    template <class Task>
+    Thread FutureThread<R>::_launch(const Thread::Attributes& attributes, Task* task) {
+        // Only a pointer is handed to Thread, so it always starts without allocating
+        #if SIMPLY_std20plus
+            if constexpr ( Task::stoppable )
+                return Thread(attributes, [task](std::stop_token token){ task->run(std::move(token)); });
+            else
+                return Thread(attributes, [task](){ task->run(); });
+        #else
+            return Thread(attributes, [task](){ task->run(); });
+        #endif
+    }
+
+    template <class R>
+    FutureThread<R>& FutureThread<R>::operator=(FutureThread&& other) {
+        // The old thread must be joined before its state goes
+        thread_ = std::move(other.thread_);
+        state_ = std::move(other.state_);
+        return *this;
+    }
+
+    template <class R>
+    bool FutureThread<R>::valid() const noexcept {
+        return state_ != nullptr;
+    }
+
+    template <class R>
+    bool FutureThread<R>::ready() const noexcept {
+        return state_ && state_->ready.load(std::memory_order_acquire);
+    }
+
+    template <class R>
+    Thread& FutureThread<R>::thread() noexcept {
+        return thread_;
+    }
+
+    template <class R>
+    const Thread& FutureThread<R>::thread() const noexcept {
+        return thread_;
+    }
+
+    template <class R>
+    void FutureThread<R>::wait() const {
+        _ensure_valid("wait");
+        while ( !state_->ready.load(std::memory_order_acquire) )
+            _futex_wait(state_->ready, 0);
+    }
+
+    template <class R>
+    template <class Rep, class Period>
+    bool FutureThread<R>::wait_for(const std::chrono::duration<Rep, Period>& timeout_duration) const {
+        return wait_until(_steady_deadline(timeout_duration));
+    }
+
+    template <class R>
+    template <class Clock, class Duration>
+    bool FutureThread<R>::wait_until(const std::chrono::time_point<Clock, Duration>& timeout_time) const {
+        _ensure_valid("wait_until");
+        while ( !state_->ready.load(std::memory_order_acquire) ) {
+            bool waiting;
+            if constexpr ( std::is_same_v<Clock, std::chrono::steady_clock> )
+                waiting = _futex_wait_until(state_->ready, 0, std::chrono::ceil<std::chrono::steady_clock::duration>(timeout_time));
+            else
+                waiting = _futex_wait_until(state_->ready, 0, _steady_deadline(timeout_time - Clock::now())) || Clock::now() < timeout_time;
+            if ( !waiting )
+                return state_->ready.load(std::memory_order_acquire);
+        }
+        return true;
+    }
+
+    template <class R>
+    R FutureThread<R>::get() {
+        _ensure_valid("get");
+        wait();
+        // The thread may still be in _futex_wake_all, which only uses the address
+        std::unique_ptr<_FutureState<R>> state = std::move(state_);
+        if ( state->error )
+            std::rethrow_exception(state->error);
+        return state->value.take();
+    }
+
+    template <class R>
+    void FutureThread<R>::_ensure_valid(const char* called_from) const {
+        if ( !state_ )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                std::string("FutureThread::") + called_from + ": No result, it was never started or was already taken!"
+            );
+    }
+}
+
+#endif // SIMPLY_FUTURE_THREAD_H_
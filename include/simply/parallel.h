@@ -0,0 +1,328 @@
+/**
+ * @file parallel.h
+ * @brief simply-threading: Data-parallel loops on a `simply::ThreadPool` - `parallel_for`, `parallel_reduce` and `parallel_transform`
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_PARALLEL_H_
+#define SIMPLY_PARALLEL_H_
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace simply {
+    // =================================================================
+    // >> Parallel algorithms
+    // =================================================================
+    ///   _ParallelStopToken {internal}
+    /// @brief `std::stop_token` for C++ 20, for C++ 17 a token that is never stopped
+    #if SIMPLY_std20plus
+        using _ParallelStopToken = std::stop_token;
+    #else
+        struct _ParallelStopToken {
+            bool stop_requested() const noexcept { return false; }
+        };
+    #endif
+
+    ///   _ParallelShard {internal}
+    /// @brief The grains `[lo, hi)` homed on one worker, packed as `lo | hi << 32`
+    ///
+    /// The owner claims from the front and thieves from the back,
+    /// so they only contend once the shard is nearly empty
+    struct alignas(cache_line_size) _ParallelShard {
+        std::atomic<uint64_t> range{0};
+
+        bool claim_front(uint32_t& grain) noexcept;
+        bool claim_back(uint32_t& grain) noexcept;
+    };
+
+    ///   _ParallelState {internal}
+    /// @brief Shared by a loop's caller and its helper tasks
+    ///
+    /// Helpers may start after the loop has returned, so this is owned
+    /// by them too, and they only touch the caller's functors after
+    /// claiming a grain
+    struct _ParallelState {
+        _ParallelState(size_t shards, uint64_t grains, _ParallelStopToken token);
+
+        void fail(std::exception_ptr exception) noexcept;
+
+        std::unique_ptr<_ParallelShard[]> shards;
+        size_t count;
+        _ParallelStopToken token;
+        std::atomic<uint32_t> active{0};
+        std::atomic<bool> closed{false};
+        std::atomic<bool> failed{false};
+        std::atomic<bool> cancelled{false};
+        std::exception_ptr error;
+    };
+
+    ///   parallel_for
+    /// @brief Calls `f(i)` for every `i` in `[first, last)` on the pool - the calling thread helps
+    ///
+    /// The range is cut into grains of `grain` indices (0 picks one), and the grains
+    /// into one contiguous shard per worker. Each worker runs its own shard front to
+    /// back, then steals grains from the back of the others. Worker `k` always gets
+    /// the same shard of a same-sized range, so repeated loops over the same data
+    /// find it in that worker's caches (pin the pool to keep it on the same core too).
+    ///
+    /// `token` {C++ std >= 20} cancels the loop: grains not yet started are skipped.
+    ///
+    /// Returns `false` if cancelled before every index ran. If `f` throws, the
+    /// remaining grains are skipped and the first exception is rethrown here.
+    /// Safe to call from a worker of the same pool.
+    template <class Index, class F, class = std::enable_if_t<std::is_integral_v<Index>>>
+    bool parallel_for(ThreadPool& pool, Index first, Index last, size_t grain, F&& f, _ParallelStopToken token = {});
+
+    ///   parallel_for
+    /// @brief As above, on a shared pool with one worker per hardware thread
+    template <class Index, class F, class = std::enable_if_t<std::is_integral_v<Index>>>
+    bool parallel_for(Index first, Index last, size_t grain, F&& f, _ParallelStopToken token = {});
+
+    ///   parallel_reduce
+    /// @brief Returns `reduce` over `map(i)` for every `i` in `[first, last)`, starting from `identity`
+    ///
+    /// Each thread reduces its grains into a partial, and the partials are reduced
+    /// together, so `reduce` must be associative and commutative, and `identity`
+    /// may be used more than once. Splits, cancels and throws as `parallel_for`,
+    /// and if cancelled, returns the reduction of what ran.
+    template <class Index, class T, class Map, class Reduce, class = std::enable_if_t<std::is_integral_v<Index>>>
+    T parallel_reduce(ThreadPool& pool, Index first, Index last, size_t grain, T identity, Map&& map, Reduce&& reduce, _ParallelStopToken token = {});
+
+    ///   parallel_reduce
+    /// @brief As above, on the shared pool
+    template <class Index, class T, class Map, class Reduce, class = std::enable_if_t<std::is_integral_v<Index>>>
+    T parallel_reduce(Index first, Index last, size_t grain, T identity, Map&& map, Reduce&& reduce, _ParallelStopToken token = {});
+
+    ///   parallel_transform
+    /// @brief Writes `f(first[i])` to `d_first[i]` for the random-access range `[first, last)`
+    ///
+    /// Splits, cancels and throws as `parallel_for`.
+    template <class InputIt, class OutputIt, class F>
+    bool parallel_transform(ThreadPool& pool, InputIt first, InputIt last, OutputIt d_first, size_t grain, F&& f, _ParallelStopToken token = {});
+
+    ///   parallel_transform
+    /// @brief As above, on the shared pool
+    template <class InputIt, class OutputIt, class F>
+    bool parallel_transform(InputIt first, InputIt last, OutputIt d_first, size_t grain, F&& f, _ParallelStopToken token = {});
+}
+
+// >> Implementations
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ _ParallelState
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline bool _ParallelShard::claim_front(uint32_t& grain) noexcept {
+        uint64_t old = range.load(std::memory_order_relaxed);
+        while ( true ) {
+            uint32_t lo = uint32_t(old), hi = uint32_t(old >> 32);
+            if ( lo >= hi )
+                return false;
+            if ( range.compare_exchange_weak(old, uint64_t(lo + 1) | uint64_t(hi) << 32) ) {
+                grain = lo;
+                return true;
+            }
+        }
+    }
+
+    inline bool _ParallelShard::claim_back(uint32_t& grain) noexcept {
+        uint64_t old = range.load(std::memory_order_relaxed);
+        while ( true ) {
+            uint32_t lo = uint32_t(old), hi = uint32_t(old >> 32);
+            if ( lo >= hi )
+                return false;
+            if ( range.compare_exchange_weak(old, uint64_t(lo) | uint64_t(hi - 1) << 32) ) {
+                grain = hi - 1;
+                return true;
+            }
+        }
+    }
+
+    inline _ParallelState::_ParallelState(size_t shards_, uint64_t grains, _ParallelStopToken token_):
+        shards(new _ParallelShard[shards_]),
+        count(shards_),
+        token(std::move(token_))
+    {
+        for ( size_t k = 0; k < count; k++ ) {
+            uint64_t lo = grains * k / count, hi = grains * (k + 1) / count;
+            shards[k].range.store(lo | hi << 32, std::memory_order_relaxed);
+        }
+    }
+
+    inline void _ParallelState::fail(std::exception_ptr exception) noexcept {
+        if ( !failed.exchange(true) )
+            error = std::move(exception);
+    }
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Parallel algorithms
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline ThreadPool& _parallel_pool() {
+        static ThreadPool pool(0, "parallel");
+        return pool;
+    }
+
+    // Picks a grain if none was given, and keeps the grain count within 32 bits
+    inline uint64_t _parallel_grain(uint64_t n, size_t grain, size_t workers) noexcept {
+        // Enough grains per worker to balance uneven work, few enough to not contend
+        constexpr uint64_t grains_per_worker = 8;
+        constexpr uint64_t max_grains = std::numeric_limits<uint32_t>::max();
+
+        uint64_t size = grain ? grain : std::max<uint64_t>(1, n / (workers * grains_per_worker));
+        return std::max(size, (n + max_grains - 1) / max_grains);
+    }
+
+    // Runs `body(grain)` for grains of the home shard, then steals from the others
+    template <class Body>
+    void _parallel_participate(_ParallelState& state, size_t home, Body&& body) noexcept {
+        auto drain = [&state, &body](size_t shard, bool owner) {
+            uint32_t grain;
+            while ( !state.closed.load() && !state.failed.load(std::memory_order_relaxed)
+                && (owner ? state.shards[shard].claim_front(grain) : state.shards[shard].claim_back(grain)) )
+            {
+                if ( state.token.stop_requested() ) {
+                    state.cancelled.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                try {
+                    body(grain);
+                }
+                catch ( ... ) {
+                    state.fail(std::current_exception());
+                }
+            }
+        };
+        if ( home < state.count )
+            drain(home, true);
+        for ( size_t k = 1; k <= state.count; k++ )
+            drain((home + k) % state.count, false);
+    }
+
+    // `work(state, home)` is run by the caller and by a helper task per other worker
+    template <class Work>
+    bool _parallel_run(ThreadPool& pool, uint64_t grains, _ParallelStopToken token, Work& work) {
+        if ( !grains )
+            return !token.stop_requested();
+
+        bool nested = ThreadPool::current() == &pool;
+        auto state = std::make_shared<_ParallelState>(pool.size(), grains, std::move(token));
+        size_t helpers = size_t(std::min<uint64_t>(grains, pool.size())) - (nested ? 1 : 0);
+        for ( size_t i = 0; i < helpers; i++ )
+            pool.submit([state, &work](){
+                // Pairs with `closed` below - the caller waits for us, or we see it's done
+                state->active.fetch_add(1);
+                if ( !state->closed.load() )
+                    work(*state, ThreadPool::current_index());
+                if ( state->active.fetch_sub(1) == 1 )
+                    _futex_wake_all(state->active);
+            });
+
+        // A caller from outside the pool has no shard, and only steals
+        work(*state, nested ? ThreadPool::current_index() : state->count);
+        state->closed.store(true);
+        for ( uint32_t active; (active = state->active.load()) != 0; )
+            _futex_wait(state->active, active);
+
+        if ( state->error )
+            std::rethrow_exception(state->error);
+        return !state->cancelled.load(std::memory_order_relaxed);
+    }
+
+    template <class Index, class F, class>
+    bool parallel_for(ThreadPool& pool, Index first, Index last, size_t grain, F&& f, _ParallelStopToken token) {
+        using Unsigned = std::make_unsigned_t<Index>;
+        if ( !(first < last) )
+            return !token.stop_requested();
+
+        uint64_t n = uint64_t(Unsigned(Unsigned(last) - Unsigned(first)));
+        uint64_t size = _parallel_grain(n, grain, pool.size());
+        auto work = [first, n, size, &f](_ParallelState& state, size_t home) {
+            _parallel_participate(state, home, [first, n, size, &f](uint32_t g) {
+                uint64_t begin = g * size, end = std::min(n, begin + size);
+                for ( uint64_t i = begin; i < end; i++ )
+                    f(Index(Unsigned(first) + Unsigned(i)));
+            });
+        };
+        return _parallel_run(pool, (n + size - 1) / size, std::move(token), work);
+    }
+
+    template <class Index, class F, class>
+    bool parallel_for(Index first, Index last, size_t grain, F&& f, _ParallelStopToken token) {
+        return parallel_for(_parallel_pool(), first, last, grain, std::forward<F>(f), std::move(token));
+    }
+
+    template <class Index, class T, class Map, class Reduce, class>
+    T parallel_reduce(ThreadPool& pool, Index first, Index last, size_t grain, T identity, Map&& map, Reduce&& reduce, _ParallelStopToken token) {
+        using Unsigned = std::make_unsigned_t<Index>;
+        if ( !(first < last) )
+            return identity;
+
+        uint64_t n = uint64_t(Unsigned(Unsigned(last) - Unsigned(first)));
+        uint64_t size = _parallel_grain(n, grain, pool.size());
+        std::mutex merge_mutex;
+        std::optional<T> result;
+        auto work = [&](_ParallelState& state, size_t home) {
+            std::optional<T> partial;
+            _parallel_participate(state, home, [&](uint32_t g) {
+                uint64_t begin = g * size, end = std::min(n, begin + size);
+                T acc = partial ? std::move(*partial) : identity;
+                partial.reset();
+                for ( uint64_t i = begin; i < end; i++ )
+                    acc = reduce(std::move(acc), map(Index(Unsigned(first) + Unsigned(i))));
+                partial.emplace(std::move(acc));
+            });
+            if ( !partial )
+                return;
+            try {
+                std::lock_guard<std::mutex> lock(merge_mutex);
+                if ( result )
+                    result.emplace(reduce(std::move(*result), std::move(*partial)));
+                else
+                    result.emplace(std::move(*partial));
+            }
+            catch ( ... ) {
+                state.fail(std::current_exception());
+            }
+        };
+        _parallel_run(pool, (n + size - 1) / size, std::move(token), work);
+        return result ? std::move(*result) : identity;
+    }
+
+    template <class Index, class T, class Map, class Reduce, class>
+    T parallel_reduce(Index first, Index last, size_t grain, T identity, Map&& map, Reduce&& reduce, _ParallelStopToken token) {
+        return parallel_reduce(
+            _parallel_pool(), first, last, grain, std::move(identity),
+            std::forward<Map>(map), std::forward<Reduce>(reduce), std::move(token)
+        );
+    }
+
+    template <class InputIt, class OutputIt, class F>
+    bool parallel_transform(ThreadPool& pool, InputIt first, InputIt last, OutputIt d_first, size_t grain, F&& f, _ParallelStopToken token) {
+        using Difference = typename std::iterator_traits<InputIt>::difference_type;
+        return parallel_for(pool, Difference(0), Difference(last - first), grain, [&first, &d_first, &f](Difference i) {
+            d_first[i] = f(first[i]);
+        }, std::move(token));
+    }
+
+    template <class InputIt, class OutputIt, class F>
+    bool parallel_transform(InputIt first, InputIt last, OutputIt d_first, size_t grain, F&& f, _ParallelStopToken token) {
+        return parallel_transform(_parallel_pool(), first, last, d_first, grain, std::forward<F>(f), std::move(token));
+    }
+}
+
+#endif // SIMPLY_PARALLEL_H_
@@ -0,0 +1,236 @@
+/**
+ * @file per_thread.h
+ * @brief simply-threading: `simply::PerThread` - a cache-line-padded slot per thread, combined on demand
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_PER_THREAD_H_
+#define SIMPLY_PER_THREAD_H_
+
+#include "threading.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace simply {
+    // =================================================================
+    // >> PerThread
+    // =================================================================
+    ///   _PerThreadSlot {internal}
+    /// @brief One thread's value, alone on its cache line(s)
+    template <class T>
+    struct alignas(cache_line_size > alignof(T) ? cache_line_size : alignof(T)) _PerThreadSlot {
+        _PerThreadSlot(): value() {}
+
+        // Constructed in place, so `T` needn't be movable
+        explicit _PerThreadSlot(const std::function<T()>& make): value(make()) {}
+
+        T value;
+    };
+
+    template <class T>
+    struct _is_atomic_number: std::false_type {};
+
+    template <class T>
+    struct _is_atomic_number<std::atomic<T>>: std::is_arithmetic<T> {};
+
+    ///   PerThread
+    /// @brief A `T` for each thread that uses it, padded to its own cache line
+    ///
+    /// Counters and histograms shared between threads bounce their cache
+    /// line between cores on every update. Here each thread updates a slot
+    /// only it writes, and readers combine the slots when they need a total.
+    ///
+    /// Slots are indexed by a small per-thread number, which a thread takes
+    /// on first use and gives back as it exits (a simply::Thread as its
+    /// function returns). The next thread given that number carries on with
+    /// the same slot, so totals keep what exited threads added, and there
+    /// are never more slots than threads alive at once. Each slot is allocated
+    /// and first touched by its thread, so it lands on that thread's NUMA node.
+    ///
+    /// `for_each` and `combine` read other threads' slots while they may be
+    /// written, which is only defined for `T`s whose reads are, such as
+    /// atomics. For `PerThread<std::atomic<X>>` use `add`, which is a relaxed
+    /// load and store - plain moves, with no locked instruction - and `sum`.
+    ///
+    /// ```c++
+    /// simply::PerThread<std::atomic<uint64_t>> requests;
+    /// requests.add(1);                    // On any thread
+    /// uint64_t total = requests.sum();    // From a stats thread
+    /// ```
+    template <class T>
+    class PerThread {
+    public:
+        ///   max_threads
+        /// @brief Threads that can hold a slot at once
+        static constexpr size_t max_threads = 16384;
+
+        /* === Constructors/Destructor === ========================== */
+        ///   Constructor
+        /// @brief Each slot is value-initialized
+        PerThread() = default;
+
+        ///   Constructor
+        /// @brief Each slot is initialized from `make()`, on the thread it belongs to
+        explicit PerThread(std::function<T()> make);
+
+        ///   Destructor
+        /// @brief Destroys every slot - no thread may still be using it
+        ~PerThread();
+
+        PerThread(const PerThread&) = delete;
+        PerThread& operator=(const PerThread&) = delete;
+
+        /* === Access === =========================================== */
+        ///   local
+        /// @brief This thread's slot, created on first use
+        /// @throws
+        ///  - system_error(resource_unavailable_try_again) if more than max_threads hold slots
+        T& local();
+
+        ///   add
+        /// @brief Add `delta` to this thread's slot, without a locked instruction
+        template <class U = T, std::enable_if_t<_is_atomic_number<U>::value, int> = 0>
+        void add(typename U::value_type delta);
+
+        ///   sum
+        /// @brief Total of every slot
+        template <class U = T, std::enable_if_t<_is_atomic_number<U>::value, int> = 0>
+        typename U::value_type sum() const noexcept;
+
+        ///   for_each
+        /// @brief Call `f(value)` for every slot, including those kept from exited threads
+        template <class F>
+        void for_each(F&& f) const;
+
+        ///   combine
+        /// @brief Fold every slot into `init` with `op(init, value)`
+        template <class R, class Op>
+        R combine(R init, Op&& op) const;
+
+        ///   size
+        /// @brief Number of slots created so far
+        size_t size() const noexcept;
+
+    private:
+        using Slot = _PerThreadSlot<T>;
+
+        static constexpr size_t page_bits = 6;
+        static constexpr size_t page_size = size_t(1) << page_bits;
+        static constexpr size_t max_pages = max_threads / page_size;
+
+        // First use by this thread, or of its index
+        T& _local_slow(uint32_t index);
+
+        std::function<T()> make_;
+        std::atomic<std::atomic<Slot*>*> pages_[max_pages] {};
+        std::atomic<size_t> size_{0};
+    };
+}
+
+// >> Implementations
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ PerThread
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    template <class T>
+    PerThread<T>::PerThread(std::function<T()> make): make_(std::move(make)) {}
+
+    template <class T>
+    PerThread<T>::~PerThread() {
+        for ( auto& page_ptr : pages_ ) {
+            std::atomic<Slot*>* page = page_ptr.load(std::memory_order_acquire);
+            if ( !page )
+                continue;
+            for ( size_t k = 0; k < page_size; k++ )
+                delete page[k].load(std::memory_order_relaxed);
+            delete[] page;
+        }
+    }
+
+    template <class T>
+    T& PerThread<T>::local() {
+        uint32_t index = _thread_index();
+        if ( index < max_threads )
+            if ( std::atomic<Slot*>* page = pages_[index >> page_bits].load(std::memory_order_acquire) )
+                // Only ever set by a thread holding this index, which handed it to us through a lock
+                if ( Slot* slot = page[index & (page_size - 1)].load(std::memory_order_relaxed) )
+                    return slot->value;
+        return _local_slow(index);
+    }
+
+    template <class T>
+    T& PerThread<T>::_local_slow(uint32_t index) {
+        if ( index >= max_threads )
+            throw std::system_error(
+                std::make_error_code(std::errc::resource_unavailable_try_again),
+                "PerThread::local: Too many threads hold a slot!"
+            );
+
+        std::atomic<std::atomic<Slot*>*>& page_ptr = pages_[index >> page_bits];
+        std::atomic<Slot*>* page = page_ptr.load(std::memory_order_acquire);
+        if ( !page ) {
+            std::atomic<Slot*>* fresh = new std::atomic<Slot*>[page_size] {};
+            if ( page_ptr.compare_exchange_strong(page, fresh, std::memory_order_acq_rel, std::memory_order_acquire) )
+                page = fresh;
+            else
+                delete[] fresh;
+        }
+
+        Slot* slot = make_ ? new Slot(make_) : new Slot();
+        page[index & (page_size - 1)].store(slot, std::memory_order_release);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return slot->value;
+    }
+
+    template <class T>
+    template <class U, std::enable_if_t<_is_atomic_number<U>::value, int>>
+    void PerThread<T>::add(typename U::value_type delta) {
+        T& value = local();
+        value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    template <class T>
+    template <class U, std::enable_if_t<_is_atomic_number<U>::value, int>>
+    typename U::value_type PerThread<T>::sum() const noexcept {
+        using Number = typename U::value_type;
+        Number total{};
+        for_each([&total](const T& value){ total += value.load(std::memory_order_relaxed); });
+        return total;
+    }
+
+    template <class T>
+    template <class F>
+    void PerThread<T>::for_each(F&& f) const {
+        for ( const auto& page_ptr : pages_ ) {
+            std::atomic<Slot*>* page = page_ptr.load(std::memory_order_acquire);
+            if ( !page )
+                continue;
+            for ( size_t k = 0; k < page_size; k++ )
+                if ( Slot* slot = page[k].load(std::memory_order_acquire) )
+                    f(static_cast<const T&>(slot->value));
+        }
+    }
+
+    template <class T>
+    template <class R, class Op>
+    R PerThread<T>::combine(R init, Op&& op) const {
+        for_each([&init, &op](const T& value){ init = op(std::move(init), value); });
+        return init;
+    }
+
+    template <class T>
+    size_t PerThread<T>::size() const noexcept {
+        return size_.load(std::memory_order_relaxed);
+    }
+}
+
+#endif // SIMPLY_PER_THREAD_H_
@@ -0,0 +1,367 @@
+/**
+ * @file periodic_thread.h
+ * @brief simply-threading: `simply::Thread` running a function at a fixed rate, against absolute deadlines
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_PERIODIC_THREAD_H_
+#define SIMPLY_PERIODIC_THREAD_H_
+
+#include "sync.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace simply {
+    // =================================================================
+    // >> PeriodicThread
+    // =================================================================
+    ///   _PeriodicState {internal}
+    /// @brief What a PeriodicThread shares with its thread - the counters, and for C++ 17 the stop
+    struct _PeriodicState {
+        virtual ~_PeriodicState() = default;
+
+        std::atomic<uint64_t> ticks{0};
+        std::atomic<uint64_t> overruns{0};
+        std::atomic<uint64_t> skipped{0};
+        std::atomic<int64_t>  max_lateness{0};
+        std::atomic<int64_t>  total_lateness{0};
+
+        #if SIMPLY_std20plus
+        #else
+            Event stop;
+        #endif
+    };
+
+    ///   PeriodicThread
+    /// @brief A `simply::Thread` calling `f(args...)` once per `period`, until stopped
+    ///
+    /// Each tick is due at an absolute steady_clock deadline, one period
+    /// after the last one, so the rate doesn't drift with the time `f`
+    /// takes or with wake up latency. The first tick is due as the thread
+    /// starts. If `f` returns a `bool`, returning `false` stops the loop.
+    ///
+    /// For C++ 20, `f` may take the thread's `std::stop_token` first, and
+    /// the sleep between ticks wakes on `request_stop` (or `join`) at once.
+    ///
+    /// Like Thread, the destructor stops and joins.
+    class PeriodicThread {
+    public:
+        ///   Overrun
+        /// @brief What to do when a tick ends after the next one was due
+        enum Overrun {
+            SKIP,       // Drop the missed ticks, keeping to the original phase
+            CATCH_UP    // Run the missed ticks back to back, until back on time
+        };
+
+        ///   Stats
+        /// @brief Counters kept by the thread, readable while it runs
+        struct Stats {
+            uint64_t ticks;                         // Calls to `f` so far
+            uint64_t overruns;                      // Ticks which ended after the next was due
+            uint64_t skipped;                       // Ticks dropped by Overrun::SKIP
+            std::chrono::nanoseconds max_lateness;  // Latest start of a tick after its deadline
+            std::chrono::nanoseconds mean_lateness;
+        };
+
+        /* === Constructors/Destructor === ========================== */
+        ///   Default constructor
+        /// @brief No thread
+        PeriodicThread() noexcept = default;
+
+        ///   Constructor
+        /// @brief Call `f(args...)` every `period` on a new thread, skipping ticks on overruns
+        /// @throws
+        ///  - system_error(invalid_argument) if `period` is not positive
+        ///  - system_error if system API calls failed
+        template <class F, class... Args, std::enable_if_t<!std::is_same_v<std::decay_t<F>, Overrun>, int> = 0>
+        PeriodicThread(std::chrono::nanoseconds period, F&& f, Args&&... args);
+
+        ///   Constructor {overrun}
+        /// @brief Call `f(args...)` every `period` on a new thread, handling overruns as `overrun`
+        template <class F, class... Args>
+        PeriodicThread(std::chrono::nanoseconds period, Overrun overrun, F&& f, Args&&... args);
+
+        ///   Constructor {attributes}
+        /// @brief As above, on a thread started with `attributes`
+        /// @throws
+        ///  - system_error(invalid_argument) if `period` is not positive
+        ///  - system_error if any attribute could not be applied
+        template <class F, class... Args, std::enable_if_t<!std::is_same_v<std::decay_t<F>, Overrun>, int> = 0>
+        PeriodicThread(const Thread::Attributes& attributes, std::chrono::nanoseconds period, F&& f, Args&&... args);
+
+        template <class F, class... Args>
+        PeriodicThread(const Thread::Attributes& attributes, std::chrono::nanoseconds period, Overrun overrun, F&& f, Args&&... args);
+
+        ///   Destructor {blocking}
+        /// @brief Stops, and joins, the thread
+        ~PeriodicThread();
+
+        PeriodicThread(const PeriodicThread&) = delete;
+        PeriodicThread& operator=(const PeriodicThread&) = delete;
+
+        ///   Move Constructor
+        PeriodicThread(PeriodicThread&& other) noexcept = default;
+
+        ///   Move Assignment {blocking}
+        /// @brief If this has a running thread, will stop and join it
+        PeriodicThread& operator=(PeriodicThread&& other);
+
+        /* === Observers === ======================================== */
+        ///   joinable
+        bool joinable() const noexcept;
+
+        ///   period
+        std::chrono::nanoseconds period() const noexcept;
+
+        ///   stats
+        /// @brief The thread's counters so far - all zero if there is no thread
+        Stats stats() const noexcept;
+
+        ///   thread
+        /// @brief The thread running the loop, such as for naming it or its priority
+        Thread& thread() noexcept;
+
+        const Thread& thread() const noexcept;
+
+        /* === Control/Operations === =============================== */
+        ///   request_stop
+        /// @brief Ask the loop to stop, waking it if between ticks
+        /// @returns `false` if there is no loop, or a stop was already requested
+        bool request_stop() noexcept;
+
+        ///   join {blocking}
+        /// @brief Stop the loop, and wait for its current tick to finish
+        /// @throws
+        ///  - system_error as for Thread::join
+        void join();
+
+    private:
+        template <class Task>
+        static Thread _launch(const Thread::Attributes& attributes, Task* task);
+
+        // Declared first, so the thread is joined before this is freed
+        std::unique_ptr<_PeriodicState> state_;
+        Thread thread_;
+        std::chrono::nanoseconds period_{0};
+    };
+
+    ///   _PeriodicTask {internal}
+    /// @brief The state together with the function, its arguments and the schedule
+    template <class F, class... Args>
+    struct _PeriodicTask: _PeriodicState {
+        #if SIMPLY_std20plus
+            static constexpr bool stoppable = std::is_invocable_v<std::decay_t<F>&, std::stop_token, std::decay_t<Args>&...>;
+        #else
+            static constexpr bool stoppable = false;
+        #endif
+
+        std::chrono::steady_clock::duration period;
+        PeriodicThread::Overrun overrun;
+        std::tuple<std::decay_t<F>, std::decay_t<Args>...> payload;
+
+        template <class G, class... A>
+        _PeriodicTask(std::chrono::nanoseconds period, PeriodicThread::Overrun overrun, G&& f, A&&... args);
+
+        // `token` is the thread's stop_token, if F takes one
+        template <class... Token>
+        bool tick(Token&... token);
+
+        // Ticks until `sleep_until(deadline)` returns `false` on a stop
+        template <class SleepUntil, class... Token>
+        void run(SleepUntil sleep_until, Token&... token);
+
+        void record(std::chrono::steady_clock::duration lateness) noexcept;
+    };
+}
+
+// =====================================================================
+// >> Implementations
+// =====================================================================
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ _PeriodicTask
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    template <class F, class... Args>
+    template <class G, class... A>
+    _PeriodicTask<F, Args...>::_PeriodicTask(std::chrono::nanoseconds period, PeriodicThread::Overrun overrun, G&& f, A&&... args):
+        period(std::chrono::ceil<std::chrono::steady_clock::duration>(period)),
+        overrun(overrun),
+        payload(std::forward<G>(f), std::forward<A>(args)...)
+    {}
+
+    template <class F, class... Args>
+    template <class... Token>
+    bool _PeriodicTask<F, Args...>::tick(Token&... token) {
+        return std::apply([&](auto& f, auto&... args){
+            // Called by reference, as it runs again next tick
+            using R = decltype(std::invoke(f, token..., args...));
+            if constexpr ( std::is_same_v<R, bool> ) {
+                return std::invoke(f, token..., args...);
+            }
+            else {
+                std::invoke(f, token..., args...);
+                return true;
+            }
+        }, payload);
+    }
+
+    template <class F, class... Args>
+    void _PeriodicTask<F, Args...>::record(std::chrono::steady_clock::duration lateness) noexcept {
+        int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(lateness).count();
+        total_lateness.fetch_add(ns, std::memory_order_relaxed);
+        if ( ns > max_lateness.load(std::memory_order_relaxed) )
+            max_lateness.store(ns, std::memory_order_relaxed);
+    }
+
+    template <class F, class... Args>
+    template <class SleepUntil, class... Token>
+    void _PeriodicTask<F, Args...>::run(SleepUntil sleep_until, Token&... token) {
+        auto next = std::chrono::steady_clock::now();
+        while ( sleep_until(next) ) {
+            auto start = std::chrono::steady_clock::now();
+            record(start - next);
+
+            bool keep_going = tick(token...);
+            ticks.fetch_add(1, std::memory_order_relaxed);
+            if ( !keep_going )
+                return;
+
+            next += period;
+            auto end = std::chrono::steady_clock::now();
+            if ( end > next ) {
+                overruns.fetch_add(1, std::memory_order_relaxed);
+                if ( overrun == PeriodicThread::Overrun::SKIP ) {
+                    // Onto the first deadline still ahead, in phase with the old ones
+                    auto missed = (end - next) / period + 1;
+                    next += missed * period;
+                    skipped.fetch_add(static_cast<uint64_t>(missed), std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ PeriodicThread
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    template <class F, class... Args, std::enable_if_t<!std::is_same_v<std::decay_t<F>, PeriodicThread::Overrun>, int>>
+    PeriodicThread::PeriodicThread(std::chrono::nanoseconds period, F&& f, Args&&... args):
+        PeriodicThread(Thread::Attributes(), period, Overrun::SKIP, std::forward<F>(f), std::forward<Args>(args)...)
+    {}
+
+    template <class F, class... Args>
+    PeriodicThread::PeriodicThread(std::chrono::nanoseconds period, Overrun overrun, F&& f, Args&&... args):
+        PeriodicThread(Thread::Attributes(), period, overrun, std::forward<F>(f), std::forward<Args>(args)...)
+    {}
+
+    template <class F, class... Args, std::enable_if_t<!std::is_same_v<std::decay_t<F>, PeriodicThread::Overrun>, int>>
+    PeriodicThread::PeriodicThread(const Thread::Attributes& attributes, std::chrono::nanoseconds period, F&& f, Args&&... args):
+        PeriodicThread(attributes, period, Overrun::SKIP, std::forward<F>(f), std::forward<Args>(args)...)
+    {}
+
+    template <class F, class... Args>
+    PeriodicThread::PeriodicThread(const Thread::Attributes& attributes, std::chrono::nanoseconds period, Overrun overrun, F&& f, Args&&... args) {
+        if ( period.count() <= 0 )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "PeriodicThread: Period must be positive!"
+            );
+        using Task = _PeriodicTask<F, Args...>;
+        auto task = std::make_unique<Task>(period, overrun, std::forward<F>(f), std::forward<Args>(args)...);
+        thread_ = _launch(attributes, task.get());
+        state_ = std::move(task);
+        period_ = period;
+    }
+
+    template <class Task>
+    Thread PeriodicThread::_launch(const Thread::Attributes& attributes, Task* task) {
+        #if SIMPLY_std20plus
+            return Thread(attributes, [task](std::stop_token token){
+                auto sleep_until = [&token](std::chrono::steady_clock::time_point deadline){
+                    return this_thread::sleep_until(deadline, token);
+                };
+                if constexpr ( Task::stoppable )
+                    task->run(sleep_until, token);
+                else
+                    task->run(sleep_until);
+            });
+        #else
+            return Thread(attributes, [task](){
+                task->run([task](std::chrono::steady_clock::time_point deadline){ return !task->stop.wait_until(deadline); });
+            });
+        #endif
+    }
+
+    inline PeriodicThread::~PeriodicThread() {
+        request_stop();
+    }
+
+    inline PeriodicThread& PeriodicThread::operator=(PeriodicThread&& other) {
+        // The old thread must be stopped and joined before its state goes
+        request_stop();
+        thread_ = std::move(other.thread_);
+        state_ = std::move(other.state_);
+        period_ = other.period_;
+        return *this;
+    }
+
+    inline bool PeriodicThread::joinable() const noexcept {
+        return thread_.joinable();
+    }
+
+    inline std::chrono::nanoseconds PeriodicThread::period() const noexcept {
+        return period_;
+    }
+
+    inline PeriodicThread::Stats PeriodicThread::stats() const noexcept {
+        if ( !state_ )
+            return Stats{0, 0, 0, std::chrono::nanoseconds(0), std::chrono::nanoseconds(0)};
+        // The total may be read a tick ahead of the count, which is close enough
+        uint64_t ticks = state_->ticks.load(std::memory_order_relaxed);
+        int64_t total = state_->total_lateness.load(std::memory_order_relaxed);
+        return Stats{
+            ticks,
+            state_->overruns.load(std::memory_order_relaxed),
+            state_->skipped.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(state_->max_lateness.load(std::memory_order_relaxed)),
+            std::chrono::nanoseconds(ticks ? total / static_cast<int64_t>(ticks) : 0)
+        };
+    }
+
+    inline Thread& PeriodicThread::thread() noexcept {
+        return thread_;
+    }
+
+    inline const Thread& PeriodicThread::thread() const noexcept {
+        return thread_;
+    }
+
+    inline bool PeriodicThread::request_stop() noexcept {
+        if ( !state_ || !thread_.joinable() )
+            return false;
+        #if SIMPLY_std20plus
+            return thread_.request_stop();
+        #else
+            bool first = !state_->stop.is_set();
+            state_->stop.set();
+            return first;
+        #endif
+    }
+
+    inline void PeriodicThread::join() {
+        request_stop();
+        thread_.join();
+    }
+}
+
+#endif // SIMPLY_PERIODIC_THREAD_H_
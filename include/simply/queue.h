@@ -0,0 +1,663 @@
+/**
+ * @file queue.h
+ * @brief simply-threading: Bounded lock-free `SpscQueue` and `MpmcQueue` channels between threads
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_QUEUE_H_
+#define SIMPLY_QUEUE_H_
+
+#include "sync.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace simply {
+    ///   _QueueSlot {internal}
+    /// @brief Uninitialised storage for one queued T
+    template <class T>
+    struct _QueueSlot {
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* get() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    // =================================================================
+    // >> SpscQueue
+    // =================================================================
+    ///   SpscQueue
+    /// @brief A bounded ring buffer of `N` items, from one producer thread to one consumer thread
+    ///
+    /// Each side keeps its index, and a cached copy of the other's, on its
+    /// own cache line, so a push or pop usually touches no line written by
+    /// the other thread. The `_n` batch methods publish all their items
+    /// with a single store.
+    ///
+    /// Blocking methods spin briefly, then park until the other side makes
+    /// progress.
+    template <class T, size_t N>
+    class SpscQueue {
+        static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue: N must be a power of two!");
+
+    public:
+        /* === Constructors/Destructor === ========================== */
+        SpscQueue() noexcept = default;
+
+        ///   Destructor
+        /// @brief Destroys any items still queued
+        ~SpscQueue();
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /* === Observers === ======================================== */
+        ///   capacity
+        static constexpr size_t capacity() noexcept { return N; }
+
+        ///   size
+        /// @brief Number of items queued - only a snapshot while either side is active
+        size_t size() const noexcept;
+
+        ///   empty
+        bool empty() const noexcept;
+
+        /* === Producer === ========================================= */
+        ///   try_emplace {producer}
+        /// @brief Construct an item in place, returning `false` if full
+        template <class... Args>
+        bool try_emplace(Args&&... args);
+
+        ///   try_push {producer}
+        /// @brief Returns `false` if full
+        bool try_push(const T& value);
+
+        bool try_push(T&& value);
+
+        ///   try_push_n {producer}
+        /// @brief Push items constructed from `first` onwards, up to `n` or until full
+        /// @returns How many were pushed
+        template <class It>
+        size_t try_push_n(It first, size_t n);
+
+        ///   push {producer} {blocking}
+        /// @brief Push, waiting while full
+        void push(T value);
+
+        #if SIMPLY_std20plus
+            ///   push {producer} {stoppable} {C++ std >= 20}
+            /// @brief Push, waiting while full, unless a stop is requested on `token`
+            /// @returns `false` if stopped, without pushing
+            bool push(T value, const std::stop_token& token);
+        #endif
+
+        /* === Consumer === ========================================= */
+        ///   try_pop {consumer}
+        /// @brief Move the oldest item to `out`, returning `false` if empty
+        bool try_pop(T& out);
+
+        ///   try_pop_n {consumer}
+        /// @brief Move up to `n` of the oldest items to `*out++`
+        /// @returns How many were popped
+        template <class OutIt>
+        size_t try_pop_n(OutIt out, size_t n);
+
+        ///   pop {consumer} {blocking}
+        /// @brief Pop the oldest item, waiting while empty
+        T pop();
+
+        ///   pop_n {consumer} {blocking}
+        /// @brief Wait while empty, then pop up to `n` items - see try_pop_n
+        template <class OutIt>
+        size_t pop_n(OutIt out, size_t n);
+
+        #if SIMPLY_std20plus
+            ///   pop {consumer} {stoppable} {C++ std >= 20}
+            /// @brief Pop the oldest item, waiting while empty, unless a stop is requested on `token`
+            /// @returns Nothing if stopped
+            std::optional<T> pop(const std::stop_token& token);
+
+            ///   pop_n {consumer} {stoppable} {C++ std >= 20}
+            /// @brief As pop_n, returning 0 if a stop is requested while empty
+            template <class OutIt>
+            size_t pop_n(OutIt out, size_t n, const std::stop_token& token);
+        #endif
+
+    private:
+        static constexpr size_t mask_ = N - 1;
+
+        template <class Consume>
+        size_t _pop_with(size_t n, Consume&& consume);
+
+        // Consumer's line
+        alignas(cache_line_size) std::atomic<size_t> head_{0};
+        size_t tail_cache_ = 0;
+
+        // Producer's line
+        alignas(cache_line_size) std::atomic<size_t> tail_{0};
+        size_t head_cache_ = 0;
+
+        // Only written when a side waits
+        alignas(cache_line_size) _EventCount not_empty_;
+        _EventCount not_full_;
+
+        alignas(cache_line_size) _QueueSlot<T> slots_[N];
+    };
+
+    // =================================================================
+    // >> MpmcQueue
+    // =================================================================
+    ///   MpmcQueue
+    /// @brief A bounded ring buffer, for any number of producer and consumer threads
+    ///
+    /// Each slot carries a sequence number telling producers and consumers
+    /// whose turn it is (D. Vyukov's bounded queue), so a push or pop is a
+    /// compare-exchange on its index plus a store to the slot, without
+    /// locks. The `_n` batch methods notify blocked threads once per batch.
+    ///
+    /// Moving a T must not throw.
+    template <class T>
+    class MpmcQueue {
+        static_assert(std::is_nothrow_move_constructible_v<T>, "MpmcQueue: T must be nothrow move constructible!");
+
+    public:
+        /* === Constructors/Destructor === ========================== */
+        ///   Constructor
+        /// @brief Room for `capacity` items, rounded up to a power of two
+        /// @throws
+        ///  - system_error(invalid_argument) if `capacity` is 0 or too large
+        explicit MpmcQueue(size_t capacity);
+
+        ///   Destructor
+        /// @brief Destroys any items still queued
+        ~MpmcQueue();
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        /* === Observers === ======================================== */
+        ///   capacity
+        size_t capacity() const noexcept;
+
+        ///   size
+        /// @brief Number of items queued - only a snapshot while any thread is active
+        size_t size() const noexcept;
+
+        ///   empty
+        bool empty() const noexcept;
+
+        /* === Producers === ======================================== */
+        ///   try_emplace
+        /// @brief Construct an item, then push it, returning `false` if full
+        template <class... Args>
+        bool try_emplace(Args&&... args);
+
+        ///   try_push
+        /// @brief Returns `false` if full
+        bool try_push(const T& value);
+
+        bool try_push(T&& value);
+
+        ///   try_push_n
+        /// @brief Push items constructed from `first` onwards, up to `n` or until full
+        /// @returns How many were pushed
+        template <class It>
+        size_t try_push_n(It first, size_t n);
+
+        ///   push {blocking}
+        /// @brief Push, waiting while full
+        void push(T value);
+
+        #if SIMPLY_std20plus
+            ///   push {stoppable} {C++ std >= 20}
+            /// @brief Push, waiting while full, unless a stop is requested on `token`
+            /// @returns `false` if stopped, without pushing
+            bool push(T value, const std::stop_token& token);
+        #endif
+
+        /* === Consumers === ======================================== */
+        ///   try_pop
+        /// @brief Move the oldest item to `out`, returning `false` if empty
+        bool try_pop(T& out);
+
+        ///   try_pop_n
+        /// @brief Move up to `n` of the oldest items to `*out++`
+        /// @returns How many were popped
+        template <class OutIt>
+        size_t try_pop_n(OutIt out, size_t n);
+
+        ///   pop {blocking}
+        /// @brief Pop the oldest item, waiting while empty
+        T pop();
+
+        ///   pop_n {blocking}
+        /// @brief Wait while empty, then pop up to `n` items - see try_pop_n
+        template <class OutIt>
+        size_t pop_n(OutIt out, size_t n);
+
+        #if SIMPLY_std20plus
+            ///   pop {stoppable} {C++ std >= 20}
+            /// @brief Pop the oldest item, waiting while empty, unless a stop is requested on `token`
+            /// @returns Nothing if stopped
+            std::optional<T> pop(const std::stop_token& token);
+
+            ///   pop_n {stoppable} {C++ std >= 20}
+            /// @brief As pop_n, returning 0 if a stop is requested while empty
+            template <class OutIt>
+            size_t pop_n(OutIt out, size_t n, const std::stop_token& token);
+        #endif
+
+    private:
+        struct _Cell {
+            std::atomic<size_t> sequence;
+            _QueueSlot<T> slot;
+        };
+
+        // Without notifying
+        bool _push_one(T&& value) noexcept;
+
+        template <class Consume>
+        bool _pop_one(Consume&& consume);
+
+        template <class Consume>
+        size_t _pop_with(size_t n, Consume&& consume);
+
+        std::unique_ptr<_Cell[]> cells_;
+        size_t mask_;
+
+        alignas(cache_line_size) std::atomic<size_t> tail_{0};
+        alignas(cache_line_size) std::atomic<size_t> head_{0};
+
+        alignas(cache_line_size) _EventCount not_empty_;
+        _EventCount not_full_;
+    };
+}
+
+// =====================================================================
+// >> Implementations
+// =====================================================================
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ SpscQueue
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    template <class T, size_t N>
+    SpscQueue<T, N>::~SpscQueue() {
+        for ( size_t i = head_.load(std::memory_order_relaxed), end = tail_.load(std::memory_order_relaxed); i != end; i++ )
+            slots_[i & mask_].get()->~T();
+    }
+
+    template <class T, size_t N>
+    size_t SpscQueue<T, N>::size() const noexcept {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        return std::min(tail - head, N);
+    }
+
+    template <class T, size_t N>
+    bool SpscQueue<T, N>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    template <class T, size_t N>
+    template <class... Args>
+    bool SpscQueue<T, N>::try_emplace(Args&&... args) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if ( tail - head_cache_ == N ) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if ( tail - head_cache_ == N )
+                return false;
+        }
+        new (slots_[tail & mask_].storage) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        not_empty_.notify();
+        return true;
+    }
+
+    template <class T, size_t N>
+    bool SpscQueue<T, N>::try_push(const T& value) {
+        return try_emplace(value);
+    }
+
+    template <class T, size_t N>
+    bool SpscQueue<T, N>::try_push(T&& value) {
+        return try_emplace(std::move(value));
+    }
+
+    template <class T, size_t N>
+    template <class It>
+    size_t SpscQueue<T, N>::try_push_n(It first, size_t n) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if ( N - (tail - head_cache_) < n )
+            head_cache_ = head_.load(std::memory_order_acquire);
+        size_t count = std::min(n, N - (tail - head_cache_));
+        size_t pushed = 0;
+        try {
+            for ( ; pushed < count; ++pushed, ++first )
+                new (slots_[(tail + pushed) & mask_].storage) T(*first);
+        }
+        catch ( ... ) {
+            // Publish those already constructed
+            tail_.store(tail + pushed, std::memory_order_release);
+            not_empty_.notify();
+            throw;
+        }
+        if ( pushed ) {
+            tail_.store(tail + pushed, std::memory_order_release);
+            not_empty_.notify();
+        }
+        return pushed;
+    }
+
+    template <class T, size_t N>
+    void SpscQueue<T, N>::push(T value) {
+        _sync_retry(not_full_, [&](){ return try_push(std::move(value)); });
+    }
+
+    #if SIMPLY_std20plus
+        template <class T, size_t N>
+        bool SpscQueue<T, N>::push(T value, const std::stop_token& token) {
+            return _sync_retry(not_full_, [&](){ return try_push(std::move(value)); }, token);
+        }
+    #endif
+
+    // Hands up to `n` items to `consume(T&&)`, then frees their slots at once
+    template <class T, size_t N>
+    template <class Consume>
+    size_t SpscQueue<T, N>::_pop_with(size_t n, Consume&& consume) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if ( tail_cache_ - head < n )
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+        size_t count = std::min(n, tail_cache_ - head);
+        size_t popped = 0;
+        auto release = [&](){
+            if ( popped ) {
+                head_.store(head + popped, std::memory_order_release);
+                not_full_.notify();
+            }
+        };
+        try {
+            for ( ; popped < count; popped++ ) {
+                T* item = slots_[(head + popped) & mask_].get();
+                consume(std::move(*item));
+                item->~T();
+            }
+        }
+        catch ( ... ) {
+            // The item `consume` threw on stays queued
+            release();
+            throw;
+        }
+        release();
+        return popped;
+    }
+
+    template <class T, size_t N>
+    bool SpscQueue<T, N>::try_pop(T& out) {
+        return _pop_with(1, [&out](T&& item){ out = std::move(item); });
+    }
+
+    template <class T, size_t N>
+    template <class OutIt>
+    size_t SpscQueue<T, N>::try_pop_n(OutIt out, size_t n) {
+        return _pop_with(n, [&out](T&& item){ *out = std::move(item); ++out; });
+    }
+
+    template <class T, size_t N>
+    T SpscQueue<T, N>::pop() {
+        std::optional<T> value;
+        _sync_retry(not_empty_, [&](){ return _pop_with(1, [&value](T&& item){ value.emplace(std::move(item)); }); });
+        return std::move(*value);
+    }
+
+    template <class T, size_t N>
+    template <class OutIt>
+    size_t SpscQueue<T, N>::pop_n(OutIt out, size_t n) {
+        size_t popped = 0;
+        if ( n )
+            _sync_retry(not_empty_, [&](){ return (popped = try_pop_n(out, n)) != 0; });
+        return popped;
+    }
+
+    #if SIMPLY_std20plus
+        template <class T, size_t N>
+        std::optional<T> SpscQueue<T, N>::pop(const std::stop_token& token) {
+            std::optional<T> value;
+            _sync_retry(not_empty_, [&](){ return _pop_with(1, [&value](T&& item){ value.emplace(std::move(item)); }); }, token);
+            return value;
+        }
+
+        template <class T, size_t N>
+        template <class OutIt>
+        size_t SpscQueue<T, N>::pop_n(OutIt out, size_t n, const std::stop_token& token) {
+            size_t popped = 0;
+            if ( n )
+                _sync_retry(not_empty_, [&](){ return (popped = try_pop_n(out, n)) != 0; }, token);
+            return popped;
+        }
+    #endif
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ MpmcQueue
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // A cell at position `pos` is free for the producer of `pos` while its
+    // sequence is `pos`, and holds an item for the consumer of `pos` while
+    // it is `pos + 1`. Popping sets it to `pos + capacity`, the next lap.
+    template <class T>
+    MpmcQueue<T>::MpmcQueue(size_t capacity) {
+        if ( capacity == 0 || capacity > (std::numeric_limits<size_t>::max() >> 2) / sizeof(_Cell) )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "MpmcQueue: Capacity must be from 1 to " + std::to_string((std::numeric_limits<size_t>::max() >> 2) / sizeof(_Cell)) + "!"
+            );
+        size_t size = 2;
+        while ( size < capacity )
+            size <<= 1;
+        cells_.reset(new _Cell[size]);
+        mask_ = size - 1;
+        for ( size_t i = 0; i < size; i++ )
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    template <class T>
+    MpmcQueue<T>::~MpmcQueue() {
+        for ( size_t i = head_.load(std::memory_order_relaxed), end = tail_.load(std::memory_order_relaxed); i != end; i++ )
+            cells_[i & mask_].slot.get()->~T();
+    }
+
+    template <class T>
+    size_t MpmcQueue<T>::capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+    template <class T>
+    size_t MpmcQueue<T>::size() const noexcept {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        // Either may have moved on between the loads
+        return tail > head ? std::min(tail - head, capacity()) : 0;
+    }
+
+    template <class T>
+    bool MpmcQueue<T>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    template <class T>
+    bool MpmcQueue<T>::_push_one(T&& value) noexcept {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for ( ;; ) {
+            _Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto lap = static_cast<std::ptrdiff_t>(sequence - pos);
+            if ( lap == 0 ) {
+                if ( tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed) ) {
+                    new (cell.slot.storage) T(std::move(value));
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if ( lap < 0 ) {
+                return false; // Still holds the item from the previous lap
+            }
+            else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template <class T>
+    template <class... Args>
+    bool MpmcQueue<T>::try_emplace(Args&&... args) {
+        // Constructed before claiming a cell, so a throw can't leave one claimed
+        return try_push(T(std::forward<Args>(args)...));
+    }
+
+    template <class T>
+    bool MpmcQueue<T>::try_push(const T& value) {
+        return try_push(T(value));
+    }
+
+    template <class T>
+    bool MpmcQueue<T>::try_push(T&& value) {
+        if ( !_push_one(std::move(value)) )
+            return false;
+        not_empty_.notify();
+        return true;
+    }
+
+    template <class T>
+    template <class It>
+    size_t MpmcQueue<T>::try_push_n(It first, size_t n) {
+        size_t pushed = 0;
+        try {
+            for ( ; pushed < n && _push_one(T(*first)); ++pushed )
+                ++first;
+        }
+        catch ( ... ) {
+            if ( pushed )
+                not_empty_.notify();
+            throw;
+        }
+        if ( pushed )
+            not_empty_.notify();
+        return pushed;
+    }
+
+    template <class T>
+    void MpmcQueue<T>::push(T value) {
+        _sync_retry(not_full_, [&](){ return try_push(std::move(value)); });
+    }
+
+    #if SIMPLY_std20plus
+        template <class T>
+        bool MpmcQueue<T>::push(T value, const std::stop_token& token) {
+            return _sync_retry(not_full_, [&](){ return try_push(std::move(value)); }, token);
+        }
+    #endif
+
+    template <class T>
+    template <class Consume>
+    bool MpmcQueue<T>::_pop_one(Consume&& consume) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        for ( ;; ) {
+            _Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto lap = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+            if ( lap == 0 ) {
+                if ( head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed) ) {
+                    T* item = cell.slot.get();
+                    struct Free {
+                        _Cell& cell; T* item; size_t next;
+                        ~Free() { item->~T(); cell.sequence.store(next, std::memory_order_release); }
+                    } free { cell, item, pos + mask_ + 1 };
+                    consume(std::move(*item));
+                    return true;
+                }
+            }
+            else if ( lap < 0 ) {
+                return false; // Not yet filled
+            }
+            else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Hands up to `n` items to `consume(T&&)` - unlike SpscQueue, one that
+    // `consume` throws on is still removed
+    template <class T>
+    template <class Consume>
+    size_t MpmcQueue<T>::_pop_with(size_t n, Consume&& consume) {
+        size_t popped = 0;
+        try {
+            while ( popped < n && _pop_one(consume) )
+                popped++;
+        }
+        catch ( ... ) {
+            not_full_.notify();
+            throw;
+        }
+        if ( popped )
+            not_full_.notify();
+        return popped;
+    }
+
+    template <class T>
+    bool MpmcQueue<T>::try_pop(T& out) {
+        return _pop_with(1, [&out](T&& item){ out = std::move(item); });
+    }
+
+    template <class T>
+    template <class OutIt>
+    size_t MpmcQueue<T>::try_pop_n(OutIt out, size_t n) {
+        return _pop_with(n, [&out](T&& item){ *out = std::move(item); ++out; });
+    }
+
+    template <class T>
+    T MpmcQueue<T>::pop() {
+        std::optional<T> value;
+        _sync_retry(not_empty_, [&](){ return _pop_with(1, [&value](T&& item){ value.emplace(std::move(item)); }); });
+        return std::move(*value);
+    }
+
+    template <class T>
+    template <class OutIt>
+    size_t MpmcQueue<T>::pop_n(OutIt out, size_t n) {
+        size_t popped = 0;
+        if ( n )
+            _sync_retry(not_empty_, [&](){ return (popped = try_pop_n(out, n)) != 0; });
+        return popped;
+    }
+
+    #if SIMPLY_std20plus
+        template <class T>
+        std::optional<T> MpmcQueue<T>::pop(const std::stop_token& token) {
+            std::optional<T> value;
+            _sync_retry(not_empty_, [&](){ return _pop_with(1, [&value](T&& item){ value.emplace(std::move(item)); }); }, token);
+            return value;
+        }
+
+        template <class T>
+        template <class OutIt>
+        size_t MpmcQueue<T>::pop_n(OutIt out, size_t n, const std::stop_token& token) {
+            size_t popped = 0;
+            if ( n )
+                _sync_retry(not_empty_, [&](){ return (popped = try_pop_n(out, n)) != 0; }, token);
+            return popped;
+        }
+    #endif
+}
+
+#endif // SIMPLY_QUEUE_H_
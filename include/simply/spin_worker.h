@@ -0,0 +1,383 @@
+/**
+ * @file spin_worker.h
+ * @brief simply-threading: `simply::SpinWorker` - a `simply::Thread` busy-polling on a dedicated, isolated CPU
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_SPIN_WORKER_H_
+#define SIMPLY_SPIN_WORKER_H_
+
+#include "topology.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace simply {
+    // =================================================================
+    // >> SpinWorker
+    // =================================================================
+    ///   _SpinState {internal}
+    /// @brief What a SpinWorker shares with its thread - the stop flag, the counters, and its CPU
+    struct _SpinState {
+        virtual ~_SpinState();
+
+        std::atomic<bool> stop{false};
+        std::atomic<uint64_t> polls{0};
+        std::atomic<uint64_t> hits{0};
+        size_t cpu = 0;
+        bool claimed = false;   // Whether this holds `cpu` in _spin_claims
+    };
+
+    ///   SpinWorker
+    /// @brief A `simply::Thread` pinned to one CPU, calling `poll(args...)` in a loop without ever parking
+    ///
+    /// For consumers where waking from a futex or an event takes too long:
+    /// the thread never sleeps, it polls its input as fast as it can. If
+    /// `poll` returns a `bool`, `true` means it found work and is called
+    /// again at once, while `false` has the thread relax (this_thread::relax)
+    /// first. Stopping is a flag read with a relaxed load between polls.
+    ///
+    /// Spinning only pays off on a CPU nothing else runs on, so placement
+    /// is checked up front: by default the CPU must be isolated from the
+    /// scheduler (`isolcpus=`) and run tickless (`nohz_full=`), and no other
+    /// SpinWorker may be on it. With Placement::ANY, only the latter holds.
+    ///
+    /// Like Thread, the destructor stops and joins.
+    ///
+    /// ```c++
+    /// simply::SpinWorker consumer(3, [&queue](){
+    ///     Order order;
+    ///     if ( !queue.try_pop(order) )
+    ///         return false;
+    ///     handle(order);
+    ///     return true;
+    /// });
+    /// ```
+    class SpinWorker {
+    public:
+        ///   Placement
+        /// @brief How the CPU must be set up for a SpinWorker to take it
+        enum Placement {
+            TICKLESS,   // Isolated, and nohz_full
+            ISOLATED,   // Isolated - the tick may still interrupt it
+            ANY         // Any online CPU - such as for testing
+        };
+
+        ///   Stats
+        /// @brief Counters kept by the thread, readable while it runs
+        struct Stats {
+            uint64_t polls;     // Calls to `poll` so far
+            uint64_t hits;      // Of those, the ones that found work
+        };
+
+        /* === Constructors/Destructor === ========================== */
+        ///   Default constructor
+        /// @brief No thread
+        SpinWorker() noexcept = default;
+
+        ///   Constructor
+        /// @brief Spin on `cpu`, which must be Placement::TICKLESS, calling `poll(args...)`
+        /// @throws
+        ///  - system_error(invalid_argument) if `cpu` is not set up for `placement`
+        ///  - system_error(device_or_resource_busy) if another SpinWorker is on `cpu`
+        ///  - system_error if the thread could not be started, or pinned
+        template <class F, class... Args, std::enable_if_t<!std::is_same_v<std::decay_t<F>, Placement>, int> = 0>
+        SpinWorker(size_t cpu, F&& poll, Args&&... args);
+
+        ///   Constructor {placement}
+        template <class F, class... Args>
+        SpinWorker(size_t cpu, Placement placement, F&& poll, Args&&... args);
+
+        ///   Constructor {attributes}
+        /// @brief As above, on a thread started with `attributes` - whose affinity is replaced by `cpu`
+        template <class F, class... Args>
+        SpinWorker(const Thread::Attributes& attributes, size_t cpu, Placement placement, F&& poll, Args&&... args);
+
+        ///   Destructor {blocking}
+        /// @brief Stops, and joins, the thread
+        ~SpinWorker();
+
+        SpinWorker(const SpinWorker&) = delete;
+        SpinWorker& operator=(const SpinWorker&) = delete;
+
+        ///   Move Constructor
+        SpinWorker(SpinWorker&& other) noexcept = default;
+
+        ///   Move Assignment {blocking}
+        /// @brief If this has a running thread, will stop and join it
+        SpinWorker& operator=(SpinWorker&& other);
+
+        /* === Observers === ======================================== */
+        ///   joinable
+        bool joinable() const noexcept;
+
+        ///   cpu
+        /// @brief The CPU spun on, only meaningful while joinable
+        size_t cpu() const noexcept;
+
+        ///   stats
+        /// @brief The thread's counters so far - all zero if there is no thread
+        Stats stats() const noexcept;
+
+        ///   thread
+        /// @brief The thread spinning, such as for reading its name, priority or stats
+        ///
+        /// Only const - joining it, or asking it to stop, would not stop the
+        /// loop, so use this class's own join and request_stop
+        const Thread& thread() const noexcept;
+
+        ///   check_placement
+        /// @brief Whether `cpu` is set up for `placement`, ignoring other SpinWorkers
+        ///
+        /// Always `false` for Windows unless Placement::ANY, as it has no
+        /// isolated CPUs to detect
+        static bool check_placement(size_t cpu, Placement placement = TICKLESS);
+
+        /* === Thread Options === =================================== */
+        ///   set_name
+        /// @brief Thread::set_name on the thread
+        void set_name(const std::string& name);
+
+        #if SIMPLY_WINDOWS
+            ///   set_priority {Windows}
+            /// @brief Thread::set_priority on the thread
+            void set_priority(Thread::Priority priority);
+
+        #elif SIMPLY_LINUX
+            ///   set_scheduling {Linux}
+            /// @brief Thread::set_scheduling on the thread
+            void set_scheduling(Thread::Policy policy, int priority = 0);
+        #endif
+
+        ///   set_qos
+        /// @brief Thread::set_qos on the thread
+        void set_qos(Thread::QoS qos);
+
+        /* === Control/Operations === =============================== */
+        ///   request_stop
+        /// @brief Ask the loop to stop after its current poll
+        /// @returns `false` if there is no loop, or a stop was already requested
+        bool request_stop() noexcept;
+
+        ///   join {blocking}
+        /// @brief Stop the loop, and wait for its current poll to finish
+        /// @throws
+        ///  - system_error as for Thread::join
+        void join();
+
+    private:
+        template <class Task>
+        static Thread _launch(const Thread::Attributes& attributes, Task* task);
+
+        // Declared first, so the thread is joined before this is freed
+        std::unique_ptr<_SpinState> state_;
+        Thread thread_;
+    };
+
+    ///   _SpinTask {internal}
+    /// @brief The state together with the function and its arguments
+    template <class F, class... Args>
+    struct _SpinTask: _SpinState {
+        std::tuple<std::decay_t<F>, std::decay_t<Args>...> payload;
+
+        template <class G, class... A>
+        explicit _SpinTask(G&& f, A&&... args);
+
+        void run();
+    };
+}
+
+// =====================================================================
+// >> Implementations
+// =====================================================================
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ _SpinTask
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // CPUs taken by a SpinWorker, so two never share one
+    struct _SpinClaims {
+        std::mutex mutex;
+        CpuSet cpus;
+    };
+
+    inline _SpinClaims& _spin_claims() noexcept {
+        static _SpinClaims claims;
+        return claims;
+    }
+
+    inline _SpinState::~_SpinState() {
+        if ( claimed ) {
+            _SpinClaims& claims = _spin_claims();
+            std::lock_guard<std::mutex> lock(claims.mutex);
+            claims.cpus.reset(cpu);
+        }
+    }
+
+    template <class F, class... Args>
+    template <class G, class... A>
+    _SpinTask<F, Args...>::_SpinTask(G&& f, A&&... args):
+        payload(std::forward<G>(f), std::forward<A>(args)...)
+    {}
+
+    template <class F, class... Args>
+    void _SpinTask<F, Args...>::run() {
+        std::apply([this](auto& f, auto&... args){
+            // Only this thread writes the counters, so they need no locked instruction
+            uint64_t count = 0, found = 0;
+            while ( !stop.load(std::memory_order_relaxed) ) {
+                polls.store(++count, std::memory_order_relaxed);
+                if constexpr ( std::is_same_v<decltype(std::invoke(f, args...)), bool> ) {
+                    if ( std::invoke(f, args...) ) {
+                        hits.store(++found, std::memory_order_relaxed);
+                        continue;
+                    }
+                }
+                else {
+                    std::invoke(f, args...);
+                }
+                this_thread::relax();
+            }
+        }, payload);
+    }
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ SpinWorker
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    template <class F, class... Args, std::enable_if_t<!std::is_same_v<std::decay_t<F>, SpinWorker::Placement>, int>>
+    SpinWorker::SpinWorker(size_t cpu, F&& poll, Args&&... args):
+        SpinWorker(Thread::Attributes(), cpu, TICKLESS, std::forward<F>(poll), std::forward<Args>(args)...)
+    {}
+
+    template <class F, class... Args>
+    SpinWorker::SpinWorker(size_t cpu, Placement placement, F&& poll, Args&&... args):
+        SpinWorker(Thread::Attributes(), cpu, placement, std::forward<F>(poll), std::forward<Args>(args)...)
+    {}
+
+    template <class F, class... Args>
+    SpinWorker::SpinWorker(const Thread::Attributes& attributes, size_t cpu, Placement placement, F&& poll, Args&&... args) {
+        if ( !check_placement(cpu, placement) )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "SpinWorker: CPU " + std::to_string(cpu) + (placement == TICKLESS ? " is not isolated and nohz_full!" :
+                                                            placement == ISOLATED ? " is not isolated!" : " is not available!")
+            );
+
+        using Task = _SpinTask<F, Args...>;
+        auto task = std::make_unique<Task>(std::forward<F>(poll), std::forward<Args>(args)...);
+        task->cpu = cpu;
+        {
+            _SpinClaims& claims = _spin_claims();
+            std::lock_guard<std::mutex> lock(claims.mutex);
+            if ( claims.cpus.test(cpu) )
+                throw std::system_error(
+                    std::make_error_code(std::errc::device_or_resource_busy),
+                    "SpinWorker: CPU " + std::to_string(cpu) + " already has a SpinWorker!"
+                );
+            claims.cpus.set(cpu);
+            task->claimed = true;
+        }
+
+        // Pinned from the start, so it never spins anywhere else
+        Thread::Attributes pinned = attributes;
+        pinned.affinity(CpuSet({cpu}));
+        thread_ = _launch(pinned, task.get());
+        state_ = std::move(task);
+    }
+
+    template <class Task>
+    Thread SpinWorker::_launch(const Thread::Attributes& attributes, Task* task) {
+        return Thread(attributes, [task](){ task->run(); });
+    }
+
+    inline SpinWorker::~SpinWorker() {
+        request_stop();
+    }
+
+    inline SpinWorker& SpinWorker::operator=(SpinWorker&& other) {
+        // The old thread must be stopped and joined before its state goes
+        request_stop();
+        thread_ = std::move(other.thread_);
+        state_ = std::move(other.state_);
+        return *this;
+    }
+
+    inline bool SpinWorker::joinable() const noexcept {
+        return thread_.joinable();
+    }
+
+    inline size_t SpinWorker::cpu() const noexcept {
+        return state_ ? state_->cpu : 0;
+    }
+
+    inline SpinWorker::Stats SpinWorker::stats() const noexcept {
+        if ( !state_ )
+            return Stats{0, 0};
+        return Stats{
+            state_->polls.load(std::memory_order_relaxed),
+            state_->hits.load(std::memory_order_relaxed)
+        };
+    }
+
+    inline const Thread& SpinWorker::thread() const noexcept {
+        return thread_;
+    }
+
+    inline void SpinWorker::set_name(const std::string& name) {
+        thread_.set_name(name);
+    }
+
+    #if SIMPLY_WINDOWS
+        inline void SpinWorker::set_priority(Thread::Priority priority) {
+            thread_.set_priority(priority);
+        }
+
+    #elif SIMPLY_LINUX
+        inline void SpinWorker::set_scheduling(Thread::Policy policy, int priority) {
+            thread_.set_scheduling(policy, priority);
+        }
+    #endif
+
+    inline void SpinWorker::set_qos(Thread::QoS qos) {
+        thread_.set_qos(qos);
+    }
+
+    inline bool SpinWorker::check_placement(size_t cpu, Placement placement) {
+        // Isolated CPUs are left out of the default affinity, so this can't go by it
+        const Topology& machine = topology();
+        if ( cpu >= CpuSet::max_cpus || !machine.online.test(cpu) )
+            return false;
+        switch ( placement ) {
+            case TICKLESS:
+                return machine.isolated.test(cpu) && machine.nohz_full.test(cpu);
+            case ISOLATED:
+                return machine.isolated.test(cpu);
+            default:
+                return true;
+        }
+    }
+
+    inline bool SpinWorker::request_stop() noexcept {
+        if ( !state_ || !thread_.joinable() )
+            return false;
+        return !state_->stop.exchange(true, std::memory_order_relaxed);
+    }
+
+    inline void SpinWorker::join() {
+        request_stop();
+        thread_.join();
+    }
+}
+
+#endif // SIMPLY_SPIN_WORKER_H_
@@ -0,0 +1,692 @@
+/**
+ * @file sync.h
+ * @brief simply-threading: `Event`, `Latch`, `Barrier` and `AdaptiveMutex` waiting directly on futex/WaitOnAddress
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_SYNC_H_
+#define SIMPLY_SYNC_H_
+
+#include "threading.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace simply {
+    // =================================================================
+    // >> Event
+    // =================================================================
+    ///   Event
+    /// @brief A manual-reset event - once `set`, every `wait` returns until it is `reset`
+    ///
+    /// The state is a single futex word, so `set` costs one atomic when
+    /// nobody is waiting, and waiters spin briefly before parking.
+    class Event {
+    public:
+        ///   Constructor
+        /// @brief Starts unset, unless `set`
+        explicit Event(bool set = false) noexcept;
+
+        Event(const Event&) = delete;
+        Event& operator=(const Event&) = delete;
+
+        ///   set
+        /// @brief Set the event, waking all waiters
+        void set() noexcept;
+
+        ///   reset
+        /// @brief Clear the event, so later waits block until the next `set`
+        void reset() noexcept;
+
+        ///   is_set
+        /// @brief Check the event without waiting
+        bool is_set() const noexcept;
+
+        ///   wait {blocking}
+        /// @brief Block until the event is set
+        void wait() const noexcept;
+
+        ///   wait_for {timed}
+        /// @brief Returns `true` if the event was set within `timeout_duration`
+        template <class Rep, class Period>
+        bool wait_for(const std::chrono::duration<Rep, Period>& timeout_duration) const;
+
+        ///   wait_until {timed}
+        /// @brief Returns `true` if the event was set by `timeout_time`
+        template <class Clock, class Duration>
+        bool wait_until(const std::chrono::time_point<Clock, Duration>& timeout_time) const;
+
+        #if SIMPLY_std20plus
+            ///   wait {stoppable} {C++ std >= 20}
+            /// @brief Block until the event is set, or a stop is requested on `token`
+            /// @returns `true` if the event was set
+            bool wait(const std::stop_token& token) const;
+        #endif
+
+    private:
+        mutable std::atomic<uint32_t> word_;
+    };
+
+    // =================================================================
+    // >> Latch
+    // =================================================================
+    ///   Latch
+    /// @brief Like `std::latch` - a single-use counter that waits block on until it reaches zero
+    class Latch {
+    public:
+        ///   Constructor
+        /// @throws
+        ///  - system_error(invalid_argument) if `expected` is negative or above `max()`
+        explicit Latch(std::ptrdiff_t expected);
+
+        Latch(const Latch&) = delete;
+        Latch& operator=(const Latch&) = delete;
+
+        ///   max
+        /// @brief The largest count a Latch can start from
+        static constexpr std::ptrdiff_t max() noexcept;
+
+        ///   count_down
+        /// @brief Decrement the count by `n`, waking all waiters on reaching zero
+        /// @throws
+        ///  - system_error(invalid_argument) if `n` is negative or more than the count left
+        void count_down(std::ptrdiff_t n = 1);
+
+        ///   try_wait
+        /// @brief Check if the count has reached zero, without waiting
+        bool try_wait() const noexcept;
+
+        ///   wait {blocking}
+        /// @brief Block until the count reaches zero
+        void wait() const noexcept;
+
+        ///   wait_for {timed}
+        /// @brief Returns `true` if the count reached zero within `timeout_duration`
+        template <class Rep, class Period>
+        bool wait_for(const std::chrono::duration<Rep, Period>& timeout_duration) const;
+
+        ///   wait_until {timed}
+        /// @brief Returns `true` if the count reached zero by `timeout_time`
+        template <class Clock, class Duration>
+        bool wait_until(const std::chrono::time_point<Clock, Duration>& timeout_time) const;
+
+        ///   arrive_and_wait {blocking}
+        /// @brief `count_down(n)`, then `wait()`
+        /// @throws
+        ///  - system_error(invalid_argument) if `n` is negative or more than the count left
+        void arrive_and_wait(std::ptrdiff_t n = 1);
+
+        #if SIMPLY_std20plus
+            ///   wait {stoppable} {C++ std >= 20}
+            /// @brief Block until the count reaches zero, or a stop is requested on `token`
+            /// @returns `true` if the count reached zero
+            bool wait(const std::stop_token& token) const;
+        #endif
+
+    private:
+        mutable std::atomic<uint32_t> word_;
+    };
+
+    // =================================================================
+    // >> Barrier
+    // =================================================================
+    ///   _NoCompletion {internal}
+    /// @brief Default Barrier completion, doing nothing
+    struct _NoCompletion {
+        void operator()() noexcept {}
+    };
+
+    ///   Barrier
+    /// @brief Like `std::barrier` - a reusable barrier for `expected` threads per phase
+    ///
+    /// When the last thread arrives, it calls `completion()` and then
+    /// starts the next phase, waking the threads waiting on this one. As
+    /// for std::barrier, `completion` must not throw - the phase would
+    /// never end, leaving every waiter blocked.
+    /// Crossing when every thread arrives while the others still spin is a
+    /// handful of atomics, without any system call.
+    template <class Completion = _NoCompletion>
+    class Barrier {
+        static_assert(std::is_nothrow_invocable_v<Completion&>, "Barrier completion must be noexcept...");
+
+    public:
+        ///   arrival_token
+        /// @brief Returned by `arrive`, to `wait` for the end of that phase
+        class arrival_token {
+        public:
+            arrival_token(arrival_token&&) noexcept = default;
+            arrival_token& operator=(arrival_token&&) noexcept = default;
+
+        private:
+            friend class Barrier;
+            explicit arrival_token(uint32_t phase) noexcept: phase_(phase) {}
+            uint32_t phase_;
+        };
+
+        ///   Constructor
+        /// @throws
+        ///  - system_error(invalid_argument) if `expected` is negative or above `max()`
+        explicit Barrier(std::ptrdiff_t expected, Completion completion = Completion());
+
+        Barrier(const Barrier&) = delete;
+        Barrier& operator=(const Barrier&) = delete;
+
+        ///   max
+        /// @brief The largest number of threads a Barrier can expect
+        static constexpr std::ptrdiff_t max() noexcept;
+
+        ///   arrive
+        /// @brief Arrive `n` times at the current phase, without waiting
+        /// @throws
+        ///  - system_error(invalid_argument) if `n` is not positive, or more than the arrivals left
+        [[nodiscard]] arrival_token arrive(std::ptrdiff_t n = 1);
+
+        ///   wait {blocking}
+        /// @brief Block until the phase `arrival` arrived at has completed
+        void wait(arrival_token&& arrival) const noexcept;
+
+        ///   arrive_and_wait {blocking}
+        /// @brief `wait(arrive())`
+        void arrive_and_wait();
+
+        ///   arrive_and_drop
+        /// @brief Arrive at the current phase, and expect one thread fewer in later phases
+        /// @throws
+        ///  - system_error(invalid_argument) if no threads are expected any more
+        void arrive_and_drop();
+
+        #if SIMPLY_std20plus
+            ///   wait {stoppable} {C++ std >= 20}
+            /// @brief Block until the phase has completed, or a stop is requested on `token`
+            /// @returns `true` if the phase completed
+            bool wait(arrival_token&& arrival, const std::stop_token& token) const;
+
+            ///   arrive_and_wait {stoppable} {C++ std >= 20}
+            /// @brief `wait(arrive(), token)` - on a stop, this thread has still arrived
+            /// @returns `true` if the phase completed
+            bool arrive_and_wait(const std::stop_token& token);
+        #endif
+
+    private:
+        void _complete(uint32_t old_phase);
+
+        mutable std::atomic<uint32_t> word_;
+        std::atomic<uint32_t> expected_;
+        Completion completion_;
+    };
+
+    // =================================================================
+    // >> AdaptiveMutex
+    // =================================================================
+    ///   AdaptiveMutex
+    /// @brief A mutex which spins while the owner will likely unlock soon, then parks
+    ///
+    /// A contended `lock` spins with exponential backoff for up to
+    /// `max_spin` (waiting on the lock word with `umwait` where the CPU has
+    /// WAITPKG, otherwise `this_thread::relax`), and only then parks on
+    /// futex/WaitOnAddress. `unlock` only makes a system call if a thread
+    /// has parked. On a single CPU it never spins.
+    ///
+    /// Meets Lockable, so works with `std::lock_guard`, `std::unique_lock`
+    /// and `std::condition_variable_any`.
+    class AdaptiveMutex {
+    public:
+        ///   default_spin
+        /// @brief Enough for a short critical section, well under a context switch
+        static constexpr std::chrono::nanoseconds default_spin = std::chrono::microseconds(4);
+
+        ///   Constructor
+        /// @brief Spin for up to `max_spin` before parking - 0 parks at once
+        explicit AdaptiveMutex(std::chrono::nanoseconds max_spin = default_spin) noexcept;
+
+        AdaptiveMutex(const AdaptiveMutex&) = delete;
+        AdaptiveMutex& operator=(const AdaptiveMutex&) = delete;
+
+        ///   lock {blocking}
+        void lock() noexcept;
+
+        ///   try_lock
+        /// @brief Returns `false` at once if already locked
+        bool try_lock() noexcept;
+
+        ///   unlock
+        /// @brief Must be called by the thread holding the lock
+        void unlock() noexcept;
+
+    private:
+        void _lock_contended() noexcept;
+
+        // 0 unlocked, 1 locked, 2 locked and threads may be parked
+        std::atomic<uint32_t> word_{0};
+        std::chrono::nanoseconds max_spin_;
+    };
+}
+
+// =====================================================================
+// >> Implementations
+// =====================================================================
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Parking
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // Each primitive is one 32-bit word, which waiters park on:
+    //  - bit 0 is set by a waiter about to park, and cleared by the
+    //    store that wakes them, so wakes cost nothing when nobody parked
+    //  - bits 1-7 are bumped by a stop request, so the futex wait of a
+    //    waiter that has just checked its stop_token fails
+    //  - bits 8-31 hold the primitive's own state
+    // Waking only uses the word's address, so a waiter may destroy the
+    // primitive as soon as it sees the state it waited for.
+    constexpr uint32_t _sync_waiters = 0x01;
+    constexpr uint32_t _sync_epoch   = 0xFE;
+    constexpr int      _sync_shift   = 8;
+
+    // Pauses before parking - a few microseconds at most, and none on a
+    // single CPU, where the thread being waited for can't run meanwhile
+    inline int _sync_spin() noexcept {
+        static const int spin = Thread::hardware_concurrency() > 1 ? 128 : 0;
+        return spin;
+    }
+
+    inline void _sync_wake(std::atomic<uint32_t>& word, uint32_t old) noexcept {
+        if ( old & _sync_waiters )
+            _futex_wake_all(word);
+    }
+
+    inline void _sync_interrupt(std::atomic<uint32_t>& word) noexcept {
+        uint32_t old = word.load(std::memory_order_relaxed);
+        while ( !word.compare_exchange_weak(old, (old & ~_sync_epoch) | ((old + 2) & _sync_epoch), std::memory_order_relaxed) ) {}
+        _futex_wake_all(word);
+    }
+
+    // Spins, then parks until `done(word)`, returning `false` if
+    // `stopped()` or `deadline` passed first
+    template <class Done, class Stopped>
+    bool _sync_park(std::atomic<uint32_t>& word, Done done, Stopped stopped, std::chrono::steady_clock::time_point deadline) noexcept {
+        uint32_t old = word.load(std::memory_order_acquire);
+        for ( int i = 0, spin = _sync_spin(); i < spin && !done(old); i++ ) {
+            _cpu_pause();
+            old = word.load(std::memory_order_acquire);
+        }
+        if ( done(old) )
+            return true;
+
+        SIMPLY_TRACE_SCOPE("wait");
+        while ( !done(old) ) {
+            if ( stopped() )
+                return false;
+            if ( !(old & _sync_waiters) && !word.compare_exchange_weak(old, old | _sync_waiters, std::memory_order_acquire) )
+                continue;
+            old |= _sync_waiters;
+            if ( deadline == std::chrono::steady_clock::time_point::max() )
+                _futex_wait(word, old);
+            else if ( !_futex_wait_until(word, old, deadline) )
+                return done(word.load(std::memory_order_acquire));
+            old = word.load(std::memory_order_acquire);
+        }
+        return true;
+    }
+
+    template <class Done>
+    void _sync_wait(std::atomic<uint32_t>& word, Done done) noexcept {
+        _sync_park(word, done, [](){ return false; }, std::chrono::steady_clock::time_point::max());
+    }
+
+    // Other clocks than steady_clock are re-checked after each wake up
+    template <class Clock, class Duration, class Done>
+    bool _sync_wait_until(std::atomic<uint32_t>& word, Done done, const std::chrono::time_point<Clock, Duration>& timeout_time) {
+        auto never = [](){ return false; };
+        if constexpr ( std::is_same_v<Clock, std::chrono::steady_clock> ) {
+            return _sync_park(word, done, never, std::chrono::ceil<std::chrono::steady_clock::duration>(timeout_time));
+        }
+        else {
+            while ( !_sync_park(word, done, never, _steady_deadline(timeout_time - Clock::now())) )
+                if ( Clock::now() >= timeout_time )
+                    return false;
+            return true;
+        }
+    }
+
+    // For waiting on state kept outside the word, such as a queue being
+    // non-empty: a waiter takes a key with `prepare`, re-checks the state,
+    // then waits on the key, while whoever changed the state calls `notify`.
+    // Bits 1-31 are bumped by each wake, so a wake after `prepare` makes the
+    // wait return at once.
+    struct _EventCount {
+        std::atomic<uint32_t> word{0};
+
+        uint32_t prepare() noexcept {
+            uint32_t key = word.fetch_or(_sync_waiters) | _sync_waiters;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return key;
+        }
+
+        void wait(uint32_t key) noexcept {
+            SIMPLY_TRACE_SCOPE("wait");
+            _futex_wait(word, key);
+        }
+
+        // Wakes only if someone has prepared since the last wake
+        void notify() noexcept {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if ( word.load(std::memory_order_relaxed) & _sync_waiters )
+                wake();
+        }
+
+        void wake() noexcept {
+            uint32_t old = word.load(std::memory_order_relaxed);
+            while ( !word.compare_exchange_weak(old, (old + 2) & ~_sync_waiters, std::memory_order_relaxed) ) {}
+            _futex_wake_all(word);
+        }
+    };
+
+    // Retries `attempt()` until it succeeds, spinning and then parking on
+    // `ready`, returning `false` if `stopped()` first
+    template <class Attempt, class Stopped>
+    bool _sync_retry(_EventCount& ready, Attempt attempt, Stopped stopped) {
+        for ( int i = 0, spin = _sync_spin(); i < spin; i++ ) {
+            if ( attempt() )
+                return true;
+            _cpu_pause();
+        }
+        while ( !attempt() ) {
+            uint32_t key = ready.prepare();
+            if ( attempt() )
+                return true;
+            if ( stopped() )
+                return false;
+            ready.wait(key);
+        }
+        return true;
+    }
+
+    template <class Attempt>
+    void _sync_retry(_EventCount& ready, Attempt attempt) {
+        _sync_retry(ready, attempt, [](){ return false; });
+    }
+
+    #if SIMPLY_std20plus
+        template <class Attempt>
+        bool _sync_retry(_EventCount& ready, Attempt attempt, const std::stop_token& token) {
+            std::stop_callback wake(token, [&ready](){ ready.wake(); });
+            return _sync_retry(ready, attempt, [&token](){ return token.stop_requested(); });
+        }
+
+        template <class Done>
+        bool _sync_wait(std::atomic<uint32_t>& word, Done done, const std::stop_token& token) {
+            std::stop_callback wake(token, [&word](){ _sync_interrupt(word); });
+            return _sync_park(word, done, [&token](){ return token.stop_requested(); }, std::chrono::steady_clock::time_point::max());
+        }
+    #endif
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Event
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    constexpr uint32_t _event_set = uint32_t(1) << _sync_shift;
+
+    inline bool _event_done(uint32_t word) noexcept {
+        return word & _event_set;
+    }
+
+    inline Event::Event(bool set) noexcept: word_(set ? _event_set : 0) {}
+
+    inline void Event::set() noexcept {
+        uint32_t old = word_.load(std::memory_order_relaxed);
+        if ( (old & _event_set) && !(old & _sync_waiters) )
+            return;
+        while ( !word_.compare_exchange_weak(old, (old | _event_set) & ~_sync_waiters, std::memory_order_release, std::memory_order_relaxed) ) {}
+        _sync_wake(word_, old);
+    }
+
+    inline void Event::reset() noexcept {
+        // Parked waiters stay marked, for the next set to wake them
+        word_.fetch_and(~_event_set, std::memory_order_relaxed);
+    }
+
+    inline bool Event::is_set() const noexcept {
+        return _event_done(word_.load(std::memory_order_acquire));
+    }
+
+    inline void Event::wait() const noexcept {
+        _sync_wait(word_, _event_done);
+    }
+
+    template <class Rep, class Period>
+    bool Event::wait_for(const std::chrono::duration<Rep, Period>& timeout_duration) const {
+        return wait_until(_steady_deadline(timeout_duration));
+    }
+
+    template <class Clock, class Duration>
+    bool Event::wait_until(const std::chrono::time_point<Clock, Duration>& timeout_time) const {
+        return _sync_wait_until(word_, _event_done, timeout_time);
+    }
+
+    #if SIMPLY_std20plus
+        inline bool Event::wait(const std::stop_token& token) const {
+            return _sync_wait(word_, _event_done, token);
+        }
+    #endif
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Latch
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline bool _latch_done(uint32_t word) noexcept {
+        return (word >> _sync_shift) == 0;
+    }
+
+    inline Latch::Latch(std::ptrdiff_t expected) {
+        if ( expected < 0 || expected > max() )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "Latch: Expected count must be from 0 to " + std::to_string(max()) + "!"
+            );
+        word_.store(static_cast<uint32_t>(expected) << _sync_shift, std::memory_order_relaxed);
+    }
+
+    constexpr std::ptrdiff_t Latch::max() noexcept {
+        return (std::ptrdiff_t(1) << (32 - _sync_shift)) - 1;
+    }
+
+    inline void Latch::count_down(std::ptrdiff_t n) {
+        uint32_t old = word_.load(std::memory_order_relaxed);
+        uint32_t next;
+        do {
+            if ( n < 0 || n > static_cast<std::ptrdiff_t>(old >> _sync_shift) )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "Latch::count_down: Counted down below zero!"
+                );
+            next = old - (static_cast<uint32_t>(n) << _sync_shift);
+            if ( _latch_done(next) )
+                next &= ~_sync_waiters;
+        } while ( !word_.compare_exchange_weak(old, next, std::memory_order_acq_rel, std::memory_order_relaxed) );
+
+        if ( _latch_done(next) )
+            _sync_wake(word_, old);
+    }
+
+    inline bool Latch::try_wait() const noexcept {
+        return _latch_done(word_.load(std::memory_order_acquire));
+    }
+
+    inline void Latch::wait() const noexcept {
+        _sync_wait(word_, _latch_done);
+    }
+
+    template <class Rep, class Period>
+    bool Latch::wait_for(const std::chrono::duration<Rep, Period>& timeout_duration) const {
+        return wait_until(_steady_deadline(timeout_duration));
+    }
+
+    template <class Clock, class Duration>
+    bool Latch::wait_until(const std::chrono::time_point<Clock, Duration>& timeout_time) const {
+        return _sync_wait_until(word_, _latch_done, timeout_time);
+    }
+
+    inline void Latch::arrive_and_wait(std::ptrdiff_t n) {
+        count_down(n);
+        wait();
+    }
+
+    #if SIMPLY_std20plus
+        inline bool Latch::wait(const std::stop_token& token) const {
+            return _sync_wait(word_, _latch_done, token);
+        }
+    #endif
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Barrier
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // Bit 8 is the phase, and bits 9-31 the arrivals left in it
+    constexpr uint32_t _barrier_phase = uint32_t(1) << _sync_shift;
+    constexpr int      _barrier_shift = _sync_shift + 1;
+
+    template <class Completion>
+    Barrier<Completion>::Barrier(std::ptrdiff_t expected, Completion completion):
+        completion_(std::move(completion))
+    {
+        if ( expected < 0 || expected > max() )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "Barrier: Expected count must be from 0 to " + std::to_string(max()) + "!"
+            );
+        word_.store(static_cast<uint32_t>(expected) << _barrier_shift, std::memory_order_relaxed);
+        expected_.store(static_cast<uint32_t>(expected), std::memory_order_relaxed);
+    }
+
+    template <class Completion>
+    constexpr std::ptrdiff_t Barrier<Completion>::max() noexcept {
+        return (std::ptrdiff_t(1) << (32 - _barrier_shift)) - 1;
+    }
+
+    template <class Completion>
+    typename Barrier<Completion>::arrival_token Barrier<Completion>::arrive(std::ptrdiff_t n) {
+        uint32_t old = word_.load(std::memory_order_relaxed);
+        uint32_t next;
+        do {
+            if ( n <= 0 || n > static_cast<std::ptrdiff_t>(old >> _barrier_shift) )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "Barrier::arrive: More arrivals than expected in this phase!"
+                );
+            next = old - (static_cast<uint32_t>(n) << _barrier_shift);
+        } while ( !word_.compare_exchange_weak(old, next, std::memory_order_acq_rel, std::memory_order_relaxed) );
+
+        uint32_t phase = old & _barrier_phase;
+        if ( (next >> _barrier_shift) == 0 )
+            _complete(phase);
+        return arrival_token(phase);
+    }
+
+    template <class Completion>
+    void Barrier<Completion>::_complete(uint32_t old_phase) {
+        completion_();
+        // Until the phase flips, only waiters marking themselves or stop
+        // requests change the word
+        uint32_t next_phase = old_phase ^ _barrier_phase;
+        uint32_t arrivals = expected_.load(std::memory_order_relaxed) << _barrier_shift;
+        uint32_t old = word_.load(std::memory_order_relaxed);
+        while ( !word_.compare_exchange_weak(old, (old & _sync_epoch) | next_phase | arrivals, std::memory_order_release, std::memory_order_relaxed) ) {}
+        _sync_wake(word_, old);
+    }
+
+    template <class Completion>
+    void Barrier<Completion>::wait(arrival_token&& arrival) const noexcept {
+        uint32_t phase = arrival.phase_;
+        _sync_wait(word_, [phase](uint32_t word){ return (word & _barrier_phase) != phase; });
+    }
+
+    template <class Completion>
+    void Barrier<Completion>::arrive_and_wait() {
+        wait(arrive());
+    }
+
+    template <class Completion>
+    void Barrier<Completion>::arrive_and_drop() {
+        uint32_t expected = expected_.load(std::memory_order_relaxed);
+        do {
+            if ( expected == 0 )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "Barrier::arrive_and_drop: No threads are expected to drop!"
+                );
+        } while ( !expected_.compare_exchange_weak(expected, expected - 1, std::memory_order_relaxed) );
+        (void) arrive();
+    }
+
+    #if SIMPLY_std20plus
+        template <class Completion>
+        bool Barrier<Completion>::wait(arrival_token&& arrival, const std::stop_token& token) const {
+            uint32_t phase = arrival.phase_;
+            return _sync_wait(word_, [phase](uint32_t word){ return (word & _barrier_phase) != phase; }, token);
+        }
+
+        template <class Completion>
+        bool Barrier<Completion>::arrive_and_wait(const std::stop_token& token) {
+            return wait(arrive(), token);
+        }
+    #endif
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ AdaptiveMutex
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline AdaptiveMutex::AdaptiveMutex(std::chrono::nanoseconds max_spin) noexcept: max_spin_(max_spin) {}
+
+    inline void AdaptiveMutex::lock() noexcept {
+        uint32_t unlocked = 0;
+        if ( !word_.compare_exchange_strong(unlocked, 1, std::memory_order_acquire, std::memory_order_relaxed) )
+            _lock_contended();
+    }
+
+    inline bool AdaptiveMutex::try_lock() noexcept {
+        uint32_t unlocked = 0;
+        return word_.compare_exchange_strong(unlocked, 1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    inline void AdaptiveMutex::unlock() noexcept {
+        if ( word_.exchange(0, std::memory_order_release) == 2 )
+            _futex_wake_one(word_);
+    }
+
+    inline void AdaptiveMutex::_lock_contended() noexcept {
+        SIMPLY_TRACE_SCOPE("lock");
+        if ( _sync_spin() && max_spin_.count() > 0 ) {
+            // The clock is only read once per round, as rounds double
+            auto deadline = std::chrono::steady_clock::now() + max_spin_;
+            for ( uint32_t backoff = 1; ; backoff = std::min<uint32_t>(backoff * 2, 64) ) {
+                uint32_t state = word_.load(std::memory_order_relaxed);
+                if ( state == 0 && word_.compare_exchange_weak(state, 1, std::memory_order_acquire, std::memory_order_relaxed) )
+                    return;
+                #if SIMPLY_WAITPKG
+                    if ( _cpu_has_waitpkg() )
+                        _cpu_umwait(&word_, _relax_cycles * backoff);
+                    else
+                #endif
+                for ( uint32_t i = 0; i < backoff; i++ )
+                    this_thread::relax();
+                if ( std::chrono::steady_clock::now() >= deadline )
+                    break;
+            }
+        }
+
+        // Marking it 2 makes the unlock wake someone, possibly needlessly
+        // once the last parked thread has taken it
+        uint32_t state = word_.exchange(2, std::memory_order_acquire);
+        while ( state != 0 ) {
+            _futex_wait(word_, 2);
+            state = word_.exchange(2, std::memory_order_acquire);
+        }
+    }
+}
+
+#endif // SIMPLY_SYNC_H_
@@ -0,0 +1,332 @@
+/**
+ * @file thread_group.h
+ * @brief simply-threading: `simply::ThreadGroup` - many `simply::Thread`s spawned, stopped and joined together
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_THREAD_GROUP_H_
+#define SIMPLY_THREAD_GROUP_H_
+
+#include "threading.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace simply {
+    // =================================================================
+    // >> ThreadGroup
+    // =================================================================
+    ///   _ThreadGroupState {internal}
+    /// @brief Shared by a ThreadGroup and its threads - the count still running, and the stop
+    struct _ThreadGroupState {
+        std::atomic<uint32_t> running{0};
+
+        #if SIMPLY_std20plus
+            std::stop_source stop_source;
+        #endif
+    };
+
+    ///   ThreadGroup
+    /// @brief Threads spawned with the same Attributes, stopped together by one stop source
+    ///
+    /// Joining threads one at a time stops them one at a time, so N threads
+    /// take the sum of their shutdown times. A group requests the stop of
+    /// all of them at once, then waits for the last one: each thread counts
+    /// itself out on exit, and `join_all` waits once on that count (for
+    /// Windows, on every thread handle with WaitForMultipleObjects).
+    ///
+    /// Thread `i` calls `f(i, args...)`, or `f(args...)` if `f` doesn't take
+    /// the index. For C++ 20, `f` may take the group's `std::stop_token` first.
+    /// A name in the Attributes is given to each thread as `name_i`.
+    ///
+    /// Like Thread, the destructor stops and joins.
+    class ThreadGroup {
+    public:
+        /* === Constructors/Destructor === ========================== */
+        ///   Constructor
+        /// @brief No threads yet, to be spawned with `attributes`
+        explicit ThreadGroup(const Thread::Attributes& attributes = Thread::Attributes());
+
+        ///   Constructor
+        /// @brief Spawn `count` threads with `attributes`, running `f`
+        /// @throws
+        ///  - system_error if a thread could not be started - those already started are kept
+        template <class F, class... Args>
+        ThreadGroup(size_t count, const Thread::Attributes& attributes, F&& f, Args&&... args);
+
+        ///   Destructor {blocking}
+        /// @brief Stops, and joins, every thread
+        ~ThreadGroup();
+
+        ThreadGroup(const ThreadGroup&) = delete;
+        ThreadGroup& operator=(const ThreadGroup&) = delete;
+
+        /* === Observers === ======================================== */
+        ///   size
+        /// @brief Threads in the group, until joined
+        size_t size() const noexcept;
+
+        ///   running
+        /// @brief Threads whose function hasn't returned yet
+        size_t running() const noexcept;
+
+        ///   operator[]
+        /// @brief The `index`th thread spawned, for per-thread control such as affinity
+        Thread& operator[](size_t index);
+
+        /* === Control/Operations === =============================== */
+        ///   spawn
+        /// @brief Add `count` threads running `f`, indexed after those already in the group
+        /// @throws
+        ///  - system_error if a thread could not be started - those already started are kept
+        template <class F, class... Args>
+        void spawn(size_t count, F&& f, Args&&... args);
+
+        #if SIMPLY_std20plus
+            ///   request_stop_all {C++ std >= 20}
+            /// @brief Request a stop on every thread at once, through the group's stop source
+            bool request_stop_all() noexcept;
+
+            ///   get_stop_source {C++ std >= 20}
+            std::stop_source get_stop_source() const noexcept;
+
+            ///   get_stop_token {C++ std >= 20}
+            std::stop_token get_stop_token() const noexcept;
+        #endif
+
+        ///   join_all {blocking}
+        /// @brief Block until every thread has finished, then join them
+        ///
+        /// For C++ 20, this calls `request_stop_all` first. The group is then
+        /// empty, with a fresh stop source for any threads spawned after.
+        void join_all();
+
+        ///   join_all_for {timed}
+        /// @brief As join_all, unless not all threads finish within `timeout_duration`
+        ///
+        /// Returns `true` if joined. On a timeout, no thread is joined.
+        template <class Rep, class Period>
+        bool join_all_for(const std::chrono::duration<Rep, Period>& timeout_duration);
+
+        ///   join_all_until {timed}
+        template <class Clock, class Duration>
+        bool join_all_until(const std::chrono::time_point<Clock, Duration>& timeout_time);
+
+    private:
+        // Waits for every thread to finish, and joins them if they did
+        bool _join_all_until(std::chrono::steady_clock::time_point deadline);
+
+        Thread::Attributes attributes_;
+        std::vector<Thread> threads_;
+        std::shared_ptr<_ThreadGroupState> state_;
+    };
+}
+
+// >> Implementations
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ ThreadGroup
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // Counts the thread out however its function ends
+    struct _ThreadGroupExit {
+        _ThreadGroupState* state;
+
+        ~_ThreadGroupExit() {
+            if ( state->running.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+                _futex_wake_all(state->running);
+        }
+    };
+
+    template <class F, class... Args>
+    void _thread_group_invoke([[maybe_unused]] _ThreadGroupState& state, [[maybe_unused]] size_t index, F&& f, Args&&... args) {
+        #if SIMPLY_std20plus
+            if constexpr ( std::is_invocable_v<F, std::stop_token, size_t, Args...> ) {
+                std::invoke(std::forward<F>(f), state.stop_source.get_token(), index, std::forward<Args>(args)...);
+                return;
+            }
+            else if constexpr ( std::is_invocable_v<F, std::stop_token, Args...> ) {
+                std::invoke(std::forward<F>(f), state.stop_source.get_token(), std::forward<Args>(args)...);
+                return;
+            }
+            else
+        #endif
+        if constexpr ( std::is_invocable_v<F, size_t, Args...> ) {
+            std::invoke(std::forward<F>(f), index, std::forward<Args>(args)...);
+        }
+        else {
+            static_assert(std::is_invocable_v<F, Args...>, "ThreadGroup function/args are malformed...");
+            std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+        }
+    }
+
+    inline ThreadGroup::ThreadGroup(const Thread::Attributes& attributes):
+        attributes_(attributes),
+        state_(std::make_shared<_ThreadGroupState>())
+    {}
+
+    template <class F, class... Args>
+    ThreadGroup::ThreadGroup(size_t count, const Thread::Attributes& attributes, F&& f, Args&&... args):
+        ThreadGroup(attributes)
+    {
+        spawn(count, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    inline ThreadGroup::~ThreadGroup() {
+        if ( !threads_.empty() )
+            join_all();
+    }
+
+    inline size_t ThreadGroup::size() const noexcept {
+        return threads_.size();
+    }
+
+    inline size_t ThreadGroup::running() const noexcept {
+        return state_->running.load(std::memory_order_acquire);
+    }
+
+    inline Thread& ThreadGroup::operator[](size_t index) {
+        if ( index >= threads_.size() )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "ThreadGroup::operator[]: Index out of range!"
+            );
+        return threads_[index];
+    }
+
+    template <class F, class... Args>
+    void ThreadGroup::spawn(size_t count, F&& f, Args&&... args) {
+        using Payload = std::tuple<std::decay_t<F>, std::decay_t<Args>...>;
+        threads_.reserve(threads_.size() + count);
+        Thread::Attributes attributes = attributes_;
+        for ( size_t n = 0; n < count; n++ ) {
+            size_t index = threads_.size();
+            if ( !attributes_.name().empty() )
+                attributes.name(_numbered_name(attributes_.name(), index));
+
+            // Each thread gets its own copy of `f` and `args`
+            state_->running.fetch_add(1, std::memory_order_relaxed);
+            try {
+                threads_.emplace_back(attributes, [state = state_, index, payload = Payload(f, args...)]() mutable {
+                    _ThreadGroupExit exit{state.get()};
+                    std::apply([&](auto&... values){
+                        _thread_group_invoke(*state, index, std::move(values)...);
+                    }, payload);
+                });
+            }
+            catch ( ... ) {
+                state_->running.fetch_sub(1, std::memory_order_relaxed);
+                throw;
+            }
+        }
+    }
+
+    #if SIMPLY_std20plus
+        inline bool ThreadGroup::request_stop_all() noexcept {
+            return state_->stop_source.request_stop();
+        }
+
+        inline std::stop_source ThreadGroup::get_stop_source() const noexcept {
+            return state_->stop_source;
+        }
+
+        inline std::stop_token ThreadGroup::get_stop_token() const noexcept {
+            return state_->stop_source.get_token();
+        }
+    #endif
+
+    inline void ThreadGroup::join_all() {
+        _join_all_until(std::chrono::steady_clock::time_point::max());
+    }
+
+    template <class Rep, class Period>
+    bool ThreadGroup::join_all_for(const std::chrono::duration<Rep, Period>& timeout_duration) {
+        return _join_all_until(_steady_deadline(timeout_duration));
+    }
+
+    template <class Clock, class Duration>
+    bool ThreadGroup::join_all_until(const std::chrono::time_point<Clock, Duration>& timeout_time) {
+        if constexpr ( std::is_same_v<Clock, std::chrono::steady_clock> ) {
+            return _join_all_until(std::chrono::ceil<std::chrono::steady_clock::duration>(timeout_time));
+        }
+        else {
+            while ( !_join_all_until(_steady_deadline(timeout_time - Clock::now())) )
+                if ( Clock::now() >= timeout_time )
+                    return false;
+            return true;
+        }
+    }
+
+    #if SIMPLY_WINDOWS
+        inline bool ThreadGroup::_join_all_until(std::chrono::steady_clock::time_point deadline) {
+            #if SIMPLY_std20plus
+                request_stop_all();
+            #endif
+            // Only MAXIMUM_WAIT_OBJECTS handles per wait, so larger groups wait in batches
+            HANDLE handles[MAXIMUM_WAIT_OBJECTS];
+            for ( size_t first = 0; first < threads_.size(); first += MAXIMUM_WAIT_OBJECTS ) {
+                DWORD count = static_cast<DWORD>(std::min<size_t>(MAXIMUM_WAIT_OBJECTS, threads_.size() - first));
+                for ( DWORD k = 0; k < count; k++ )
+                    handles[k] = threads_[first + k].native_handle();
+
+                DWORD timeout = INFINITE;
+                if ( deadline != std::chrono::steady_clock::time_point::max() ) {
+                    auto remaining = deadline - std::chrono::steady_clock::now();
+                    auto ms = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+                    timeout = static_cast<DWORD>(std::clamp<long long>(ms, 0, INFINITE - 1));
+                }
+                switch ( WaitForMultipleObjects(count, handles, TRUE, timeout) ) {
+                    case WAIT_TIMEOUT:
+                        return false;
+
+                    case WAIT_FAILED:
+                        throw std::system_error(GetLastError(), std::system_category());
+
+                    default:
+                        break;
+                }
+            }
+            for ( Thread& thread : threads_ )
+                thread.join();
+            threads_.clear();
+            state_ = std::make_shared<_ThreadGroupState>();
+            return true;
+        }
+
+    #elif SIMPLY_LINUX
+        inline bool ThreadGroup::_join_all_until(std::chrono::steady_clock::time_point deadline) {
+            #if SIMPLY_std20plus
+                request_stop_all();
+            #endif
+            // Only the last thread out wakes us, and a stale count just returns at once
+            bool forever = deadline == std::chrono::steady_clock::time_point::max();
+            for ( uint32_t running; (running = state_->running.load(std::memory_order_acquire)) != 0; ) {
+                if ( forever )
+                    _futex_wait(state_->running, running);
+                else if ( !_futex_wait_until(state_->running, running, deadline) && state_->running.load(std::memory_order_acquire) )
+                    return false;
+            }
+            // Every function has returned, so these only reap exiting threads
+            for ( Thread& thread : threads_ )
+                thread.join();
+            threads_.clear();
+            state_ = std::make_shared<_ThreadGroupState>();
+            return true;
+        }
+
+    #endif
+}
+
+#endif // SIMPLY_THREAD_GROUP_H_
@@ -0,0 +1,413 @@
+/**
+ * @file thread_pool.h
+ * @brief simply-threading: Work-stealing pool of `simply::Thread` workers
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_THREAD_POOL_H_
+#define SIMPLY_THREAD_POOL_H_
+
+#include "threading.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace simply {
+    // =================================================================
+    // >> ThreadPool
+    // =================================================================
+    ///   _PoolTask {internal}
+    /// @brief Type-erased unit of work queued on a ThreadPool
+    struct _PoolTask {
+        virtual ~_PoolTask() = default;
+        virtual void run() noexcept = 0;
+    };
+
+    ///   _WorkStealingDeque {internal}
+    /// @brief Bounded Chase-Lev deque
+    ///
+    /// The owning worker pushes and pops at the bottom, any other
+    /// thread may steal from the top
+    class _WorkStealingDeque {
+    public:
+        static constexpr int64_t capacity = 1024;
+
+        ///   push {owner}
+        /// @brief Returns `false` if the deque is full
+        bool push(_PoolTask* task) noexcept;
+
+        ///   pop {owner}
+        _PoolTask* pop() noexcept;
+
+        ///   steal
+        /// @brief Returns `nullptr` if empty, or if another thread won the race
+        _PoolTask* steal() noexcept;
+
+        ///   empty
+        bool empty() const noexcept;
+
+    private:
+        alignas(cache_line_size) std::atomic<int64_t> top_{0};
+        alignas(cache_line_size) std::atomic<int64_t> bottom_{0};
+        alignas(cache_line_size) std::atomic<_PoolTask*> buffer_[capacity];
+    };
+
+    ///   ThreadPool
+    /// @brief A fixed set of `simply::Thread` workers running submitted tasks
+    ///
+    /// Tasks submitted from a worker go onto that worker's own lock-free
+    /// deque, all other submissions go onto a shared queue. Workers that
+    /// run out of work steal from each other before parking.
+    class ThreadPool {
+    public:
+        /* === Constructors/Destructor === ========================== */
+        ///   Constructor
+        /// @brief Start `workers` threads, named `name` followed by their index
+        ///
+        /// If `workers` is 0, `Thread::hardware_concurrency` threads are started
+        explicit ThreadPool(unsigned int workers = 0, const std::string& name = "pool");
+
+        ///   Destructor {blocking}
+        /// @brief Runs all queued tasks, then stops and joins the workers
+        ~ThreadPool();
+
+        ///   Single-Ownership
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /* === Control/Operations === =============================== */
+        ///   submit
+        /// @brief Queue `f(args...)` to run on one of the workers
+        ///
+        /// As for `Thread`, an exception escaping the task terminates the program
+        template <class F, class... Args>
+        void submit(F&& f, Args&&... args);
+
+        ///   wait_idle {blocking}
+        /// @brief Block until every submitted task has finished
+        ///
+        /// Must not be called from one of this pool's own workers
+        void wait_idle();
+
+        /* === Observers === ======================================== */
+        ///   size
+        /// @brief Number of worker threads
+        size_t size() const noexcept;
+
+        /* === Static Methods === =================================== */
+        ///   current
+        /// @brief Pool the calling thread is a worker of, `nullptr` if none
+        static ThreadPool* current() noexcept;
+
+        ///   current_index
+        /// @brief Index of the calling worker in `current()`, `0` if not a worker
+        static size_t current_index() noexcept;
+
+    private:
+        struct _Worker {
+            _WorkStealingDeque deque;
+            Thread thread;
+        };
+
+        template <class StopCheck>
+        void _run(size_t index, StopCheck&& stop_requested) noexcept;
+
+        void _push(_PoolTask* task);
+
+        _PoolTask* _find_task(size_t index) noexcept;
+
+        bool _has_work() const noexcept;
+
+        void _execute(_PoolTask* task) noexcept;
+
+        // Wake a parked worker, if there are any
+        void _notify();
+
+        // Stop and join every worker started so far
+        void _shutdown();
+
+        size_t size_;
+        std::unique_ptr<_Worker[]> workers_;
+
+        // Submissions from outside the pool
+        std::mutex inject_mutex_;
+        std::deque<_PoolTask*> inject_;
+        std::atomic<size_t> inject_size_{0};
+
+        // Parking for idle workers
+        std::mutex park_mutex_;
+        std::condition_variable park_cv_;
+        std::atomic<unsigned int> sleepers_{0};
+
+        // Completion tracking for wait_idle
+        alignas(cache_line_size) std::atomic<size_t> pending_{0};
+        std::mutex idle_mutex_;
+        std::condition_variable idle_cv_;
+
+        #if SIMPLY_std20plus
+            // Workers are stopped through their Thread's stop_token
+        #else
+            std::atomic<bool> stopping_{false};
+        #endif
+    };
+}
+
+// =====================================================================
+// >> Implementations
+// =====================================================================
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ _PoolTask
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    template <class T>
+    struct _PoolTaskImpl final : _PoolTask {
+        template <class... U>
+        explicit _PoolTaskImpl(U&&... u): args_(std::forward<U>(u)...) {}
+
+        void run() noexcept override {
+            std::apply([](auto&... args){ std::invoke(std::move(args)...); }, args_);
+        }
+
+        T args_;
+    };
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ _WorkStealingDeque
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // Following Le, Pop, Cohen & Nardelli, "Correct and Efficient
+    // Work-Stealing for Weak Memory Models" (2013)
+    inline bool _WorkStealingDeque::push(_PoolTask* task) noexcept {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_acquire);
+        if ( b - t >= capacity )
+            return false;
+        buffer_[b & (capacity - 1)].store(task, std::memory_order_relaxed);
+        bottom_.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    inline _PoolTask* _WorkStealingDeque::pop() noexcept {
+        int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+
+        if ( t > b ) {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        _PoolTask* task = buffer_[b & (capacity - 1)].load(std::memory_order_relaxed);
+        if ( t == b ) {
+            // Last item - race any thieves for it
+            if ( !top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed) )
+                task = nullptr;
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    inline _PoolTask* _WorkStealingDeque::steal() noexcept {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom_.load(std::memory_order_acquire);
+
+        if ( t >= b )
+            return nullptr;
+
+        _PoolTask* task = buffer_[t & (capacity - 1)].load(std::memory_order_relaxed);
+        if ( !top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed) )
+            return nullptr;
+        return task;
+    }
+
+    inline bool _WorkStealingDeque::empty() const noexcept {
+        return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+    }
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ ThreadPool
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    struct _PoolWorkerInfo {
+        ThreadPool* pool = nullptr;
+        size_t index = 0;
+    };
+
+    inline _PoolWorkerInfo& _pool_worker_info() noexcept {
+        static thread_local _PoolWorkerInfo info;
+        return info;
+    }
+
+    inline ThreadPool::ThreadPool(unsigned int workers, const std::string& name):
+        size_(workers ? workers : std::max(1u, Thread::hardware_concurrency())),
+        workers_(new _Worker[size_])
+    {
+        try {
+            for ( size_t i = 0; i < size_; i++ ) {
+                Thread::Attributes attributes;
+                attributes.name(_numbered_name(name, i));
+                #if SIMPLY_std20plus
+                    workers_[i].thread = Thread(attributes, [this, i](std::stop_token token){
+                        _run(i, [&token](){ return token.stop_requested(); });
+                    });
+                #else
+                    workers_[i].thread = Thread(attributes, [this, i](){
+                        _run(i, [this](){ return stopping_.load(std::memory_order_acquire); });
+                    });
+                #endif
+            }
+        }
+        catch ( ... ) {
+            // The workers already running would otherwise be joined without ever being told to stop
+            _shutdown();
+            throw;
+        }
+    }
+
+    inline ThreadPool::~ThreadPool() {
+        _shutdown();
+    }
+
+    inline void ThreadPool::_shutdown() {
+        #if SIMPLY_std20plus
+            for ( size_t i = 0; i < size_; i++ )
+                workers_[i].thread.request_stop();
+        #else
+            stopping_.store(true, std::memory_order_release);
+        #endif
+        {
+            std::lock_guard<std::mutex> lock(park_mutex_);
+            park_cv_.notify_all();
+        }
+        for ( size_t i = 0; i < size_; i++ )
+            if ( workers_[i].thread.joinable() )
+                workers_[i].thread.join();
+    }
+
+    template <class F, class... Args>
+    void ThreadPool::submit(F&& f, Args&&... args) {
+        static_assert(std::is_invocable_v<std::decay_t<F>, std::decay_t<Args>...>, "ThreadPool task/args are malformed...");
+        using T = std::tuple<std::decay_t<F>, std::decay_t<Args>...>;
+        _PoolTask* task = new _PoolTaskImpl<T>(std::forward<F>(f), std::forward<Args>(args)...);
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        _push(task);
+    }
+
+    inline void ThreadPool::wait_idle() {
+        std::unique_lock<std::mutex> lock(idle_mutex_);
+        idle_cv_.wait(lock, [this](){ return pending_.load(std::memory_order_acquire) == 0; });
+    }
+
+    inline size_t ThreadPool::size() const noexcept {
+        return size_;
+    }
+
+    inline ThreadPool* ThreadPool::current() noexcept {
+        return _pool_worker_info().pool;
+    }
+
+    inline size_t ThreadPool::current_index() noexcept {
+        return _pool_worker_info().index;
+    }
+
+    template <class StopCheck>
+    void ThreadPool::_run(size_t index, StopCheck&& stop_requested) noexcept {
+        // Yields before parking, so bursts of submissions don't pay for a wakeup
+        constexpr unsigned int spin_limit = 64;
+
+        _pool_worker_info() = _PoolWorkerInfo{this, index};
+        unsigned int idle_spins = 0;
+        while ( true ) {
+            if ( _PoolTask* task = _find_task(index) ) {
+                _execute(task);
+                idle_spins = 0;
+                continue;
+            }
+            if ( stop_requested() )
+                break;
+            if ( idle_spins++ < spin_limit ) {
+                this_thread::yield();
+                continue;
+            }
+
+            // Announce the sleeper before the final check, pairs with _notify
+            std::unique_lock<std::mutex> lock(park_mutex_);
+            sleepers_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if ( !_has_work() && !stop_requested() )
+                park_cv_.wait(lock);
+            sleepers_.fetch_sub(1, std::memory_order_relaxed);
+            idle_spins = 0;
+        }
+        _pool_worker_info() = _PoolWorkerInfo{};
+    }
+
+    inline void ThreadPool::_push(_PoolTask* task) {
+        _PoolWorkerInfo& info = _pool_worker_info();
+        if ( info.pool != this || !workers_[info.index].deque.push(task) ) {
+            std::lock_guard<std::mutex> lock(inject_mutex_);
+            inject_.push_back(task);
+            inject_size_.fetch_add(1, std::memory_order_relaxed);
+        }
+        _notify();
+    }
+
+    inline _PoolTask* ThreadPool::_find_task(size_t index) noexcept {
+        if ( _PoolTask* task = workers_[index].deque.pop() )
+            return task;
+
+        if ( inject_size_.load(std::memory_order_relaxed) ) {
+            std::lock_guard<std::mutex> lock(inject_mutex_);
+            if ( !inject_.empty() ) {
+                _PoolTask* task = inject_.front();
+                inject_.pop_front();
+                inject_size_.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+
+        for ( size_t k = 1; k < size_; k++ )
+            if ( _PoolTask* task = workers_[(index + k) % size_].deque.steal() )
+                return task;
+        return nullptr;
+    }
+
+    inline bool ThreadPool::_has_work() const noexcept {
+        if ( inject_size_.load(std::memory_order_relaxed) )
+            return true;
+        for ( size_t i = 0; i < size_; i++ )
+            if ( !workers_[i].deque.empty() )
+                return true;
+        return false;
+    }
+
+    inline void ThreadPool::_execute(_PoolTask* task) noexcept {
+        task->run();
+        delete task;
+        if ( pending_.fetch_sub(1, std::memory_order_acq_rel) == 1 ) {
+            std::lock_guard<std::mutex> lock(idle_mutex_);
+            idle_cv_.notify_all();
+        }
+    }
+
+    inline void ThreadPool::_notify() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if ( sleepers_.load(std::memory_order_relaxed) ) {
+            std::lock_guard<std::mutex> lock(park_mutex_);
+            park_cv_.notify_one();
+        }
+    }
+}
+
+#endif // SIMPLY_THREAD_POOL_H_
@@ -18,6 +18,8 @@
  *                - Sometimes compilers on Windows may miss parts of the SDK after Windows 7
  *                - Notably, you may lose the ability to use get_stack_size, and this makes that explicit
  * - _WIN32_WINNT=0x0602 - An alternative is to manually set this, which may sometimes work
+ * - SIMPLY_TRACE=1 - Record thread lifecycle, sleep and wait events for `simply::Trace`
+ *                  - Without it, the hooks and SIMPLY_TRACE_* macros compile to nothing
  */
 
 #define SIMPLY_WINDOWS defined(_WIN32)
@@ -35,29 +37,95 @@
 #define SIMPLY_std20plus SIMPLY_stdVERSION >= 202002L
 #define SIMPLY_std23plus SIMPLY_stdVERSION >= 202302L
 
+#ifdef _MSC_VER
+    #define SIMPLY_NOINLINE __declspec(noinline)
+#else
+    #define SIMPLY_NOINLINE __attribute__((noinline))
+#endif
+
+#ifndef SIMPLY_TRACE
+    #define SIMPLY_TRACE 0
+#endif
+
+///   SIMPLY_TRACE_SCOPE / SIMPLY_TRACE_INSTANT
+/// @brief Record a span lasting until the end of the scope, or a single
+/// point, on this thread's trace - `name` must be a string literal
+#if SIMPLY_TRACE
+    #define SIMPLY_TRACE_CONCAT_(a, b) a##b
+    #define SIMPLY_TRACE_CONCAT(a, b) SIMPLY_TRACE_CONCAT_(a, b)
+    #define SIMPLY_TRACE_SCOPE(name) ::simply::_TraceScope SIMPLY_TRACE_CONCAT(_simply_trace_, __LINE__)(name)
+    #define SIMPLY_TRACE_INSTANT(name) ::simply::_trace_event('i', name)
+#else
+    #define SIMPLY_TRACE_SCOPE(name) ((void)0)
+    #define SIMPLY_TRACE_INSTANT(name) ((void)0)
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
 #include <chrono>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
+#include <initializer_list>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #if SIMPLY_std20plus
     #include <stop_token>
 #endif
 
+// CPUID, rdtsc and WAITPKG for this_thread::relax
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+    #include <x86intrin.h>
+#endif
+
 #if SIMPLY_WINDOWS
     // #if !defined(SIMPLY_WIN_7) && _WIN32_WINNT < 0x0602
     //     #error "simply-threading: Windows API < 8 - compile with either -DSIMPLY_WIN_7 or -D_WIN32_WINNT=0x0602 - see threading.h notices"
     // #endif
     #include <windows.h>
+    #include <io.h>
+    #include <malloc.h>
+    #include <process.h>
+
+    // WaitOnAddress/WakeByAddress*
+    #ifdef _MSC_VER
+        #pragma comment(lib, "Synchronization.lib")
+    #endif
 
 #elif SIMPLY_LINUX
+    #include <alloca.h>
+    #include <climits>
+    #include <linux/futex.h>
     #include <pthread.h>
+    #include <sched.h>
+    #include <sys/mman.h>
+    #include <sys/prctl.h>
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
     #include <unistd.h>
 
+    // Older libc headers lack it, the kernel has had it since 3.14
+    #ifndef SCHED_DEADLINE
+        #define SCHED_DEADLINE 6
+    #endif
+
 #endif
 
 namespace simply {
@@ -65,9 +133,269 @@ namespace simply {
     /// @brief Milliseconds for use in timed functions
     using ms_type = uint32_t;
 
+    ///   cache_line_size
+    /// @brief Alignment used to keep independently written data on separate cache lines
+    constexpr size_t cache_line_size = 64;
+
+    // =================================================================
+    // >> CpuSet
+    // =================================================================
+    ///   CpuSet
+    /// @brief A set of logical CPUs, used for thread affinity
+    ///
+    /// For Windows, CPU `i` is processor `i % 64` of processor group `i / 64`
+    class CpuSet {
+    public:
+        ///   max_cpus
+        /// @brief One more than the highest CPU index that can be held
+        static constexpr size_t max_cpus = 1024;
+
+        /* === Constructors === ===================================== */
+        ///   CpuSet
+        /// @brief An empty set
+        CpuSet() noexcept = default;
+
+        ///   CpuSet
+        /// @brief A set holding each of `cpus`
+        /// @throws
+        ///  - system_error(invalid_argument) if any is not below max_cpus
+        CpuSet(std::initializer_list<size_t> cpus);
+
+        /* === Modifiers === ======================================== */
+        ///   set
+        /// @brief Add `cpu` to the set
+        /// @throws
+        ///  - system_error(invalid_argument) if `cpu` is not below max_cpus
+        CpuSet& set(size_t cpu);
+
+        ///   reset
+        /// @brief Remove `cpu` from the set
+        /// @throws
+        ///  - system_error(invalid_argument) if `cpu` is not below max_cpus
+        CpuSet& reset(size_t cpu);
+
+        ///   clear
+        /// @brief Remove all CPUs from the set
+        void clear() noexcept;
+
+        /* === Observers === ======================================== */
+        ///   test
+        /// @brief Check if `cpu` is in the set
+        bool test(size_t cpu) const noexcept;
+
+        ///   count
+        /// @brief Number of CPUs in the set
+        size_t count() const noexcept;
+
+        ///   empty
+        bool empty() const noexcept;
+
+        ///   first
+        /// @brief Lowest CPU in the set, max_cpus if empty
+        size_t first() const noexcept;
+
+        /* === Comparisons === ====================================== */
+        friend bool operator==(const CpuSet& lhs, const CpuSet& rhs) noexcept;
+        friend bool operator!=(const CpuSet& lhs, const CpuSet& rhs) noexcept;
+
+    private:
+        void _ensure_valid(size_t cpu, const std::string& called_from) const;
+
+        std::bitset<max_cpus> bits_;
+    };
+
+    #if SIMPLY_LINUX
+        // =============================================================
+        // >> StackPool
+        // =============================================================
+        ///   StackPool {Linux}
+        /// @brief Hands out pre-mapped thread stacks, and takes them back when threads join
+        ///
+        /// Threads started with a pool do not pay an mmap/munmap pair, and
+        /// reused stacks are already faulted in. Each stack has a PROT_NONE
+        /// guard region below it.
+        ///
+        /// The pool must outlive every Thread using it, and Threads using it
+        /// cannot be detached, as the stack can only be reused once joined.
+        class StackPool {
+        public:
+            ///   Constructor
+            /// @brief Pool of stacks with `stack_size` usable bytes each
+            ///
+            /// Sizes are rounded up to whole pages. A `guard_size` of 0 uses
+            /// one page. If `prefault` is set, new stacks are populated on mapping.
+            explicit StackPool(size_t stack_size, size_t guard_size = 0, bool prefault = false);
+
+            ///   Destructor
+            /// @brief Unmaps all stacks currently in the pool
+            ~StackPool();
+
+            StackPool(const StackPool&) = delete;
+            StackPool& operator=(const StackPool&) = delete;
+
+            ///   reserve
+            /// @brief Map stacks until at least `count` are available
+            void reserve(size_t count);
+
+            ///   available
+            /// @brief Number of stacks ready to be handed out
+            size_t available() const;
+
+            ///   stack_size
+            size_t stack_size() const noexcept;
+
+            ///   guard_size
+            size_t guard_size() const noexcept;
+
+        private:
+            friend class Thread;
+
+            // Returns the start of the mapping (guard included)
+            void* _acquire();
+
+            void _release(void* mapping) noexcept;
+
+            void* _map() const;
+
+            size_t stack_size_;
+            size_t guard_size_;
+            bool prefault_;
+
+            mutable std::mutex mutex_;
+            std::vector<void*> free_;
+        };
+    #endif
+
+    // =================================================================
+    // >> Arena
+    // =================================================================
+    class Arena;
+
+    ///   ArenaResource
+    /// @brief `std::pmr::memory_resource` adapter over an Arena
+    ///
+    /// ```c++
+    /// std::pmr::vector<Order> orders(&this_thread::arena()->resource());
+    /// ```
+    class ArenaResource: public std::pmr::memory_resource {
+    public:
+        explicit ArenaResource(Arena& arena) noexcept;
+
+        ///   arena
+        Arena& arena() const noexcept;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        Arena* arena_;
+    };
+
+    ///   _ArenaBlock {internal}
+    /// @brief Header of each block an Arena carves up, its bytes following it
+    struct alignas(std::max_align_t) _ArenaBlock {
+        _ArenaBlock* next;
+        size_t size;            // Usable bytes after the header
+    };
+
+    ///   Arena
+    /// @brief Single-threaded bump allocator, with free lists for small sizes
+    ///
+    /// Allocation bumps a pointer through blocks of `block_size` bytes,
+    /// taken from the global allocator only when one runs out. Freed small
+    /// allocations (up to 256 bytes) are kept for reuse by the same size,
+    /// larger ones only when freed last-in-first-out. Everything else is
+    /// freed at once, by `reset` or the destructor.
+    ///
+    /// Only the owning thread may use an Arena - memory from it is freed
+    /// through it, or not at all. Opt a Thread into one with
+    /// `Thread::Attributes().arena(block_size)`, and reach it from `this_thread::arena()`.
+    class Arena {
+    public:
+        ///   default_block_size
+        static constexpr size_t default_block_size = 64 * 1024;
+
+        /* === Constructors/Destructor === ========================== */
+        ///   Constructor
+        /// @brief Takes no memory until the first allocation
+        explicit Arena(size_t block_size = default_block_size) noexcept;
+
+        ///   Destructor
+        /// @brief Frees every block, invalidating all memory from this
+        ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /* === Control/Operations === =============================== */
+        ///   allocate
+        /// @brief `bytes` aligned to `alignment`, which must be a power of two
+        /// @throws
+        ///  - std::bad_alloc if a new block could not be allocated
+        void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+        ///   deallocate
+        /// @brief Give back `p`, from `allocate(bytes, alignment)`, for reuse
+        void deallocate(void* p, size_t bytes, size_t alignment = alignof(std::max_align_t)) noexcept;
+
+        ///   reset
+        /// @brief Take back every allocation at once, keeping the blocks for reuse
+        ///
+        /// For request-scoped work - all memory from this becomes invalid
+        void reset() noexcept;
+
+        /* === Observers === ======================================== */
+        ///   used
+        /// @brief Bytes handed out since the last reset, not counting reuse
+        size_t used() const noexcept;
+
+        ///   reserved
+        /// @brief Bytes of blocks held, in use or kept for reuse
+        size_t reserved() const noexcept;
+
+        ///   block_size
+        size_t block_size() const noexcept;
+
+        ///   resource
+        /// @brief This as a `std::pmr::memory_resource`
+        ArenaResource& resource() noexcept;
+
+    private:
+        static constexpr size_t _small_step = 16;
+        static constexpr size_t _small_max = 256;
+        static constexpr size_t _small_classes = _small_max / _small_step;
+
+        void* _bump(size_t bytes, size_t alignment);
+
+        void* _allocate_slow(size_t bytes, size_t alignment);
+
+        static _ArenaBlock* _new_block(size_t size);
+
+        static void _free_blocks(_ArenaBlock* block) noexcept;
+
+        char* cursor_ = nullptr;
+        char* end_ = nullptr;
+        void* free_[_small_classes] = {};   // Intrusive lists of freed small allocations
+        _ArenaBlock* blocks_ = nullptr;     // In use, newest first
+        _ArenaBlock* spare_ = nullptr;      // Full-sized blocks kept by reset
+        size_t block_size_;
+        size_t used_ = 0;
+        size_t reserved_ = 0;
+        ArenaResource resource_;
+    };
+
     // =================================================================
     // >> Thread
     // =================================================================
+    // Whether the first Thread constructor argument selects a constructor,
+    // rather than being the thread function - defined after Thread
+    template <class F>
+    struct _is_thread_option;
+
+    // A parked OS thread of the ThreadCache - defined with it
+    struct _StandbyWorker;
+
     class Thread {
     public:
         #if SIMPLY_WINDOWS
@@ -81,6 +409,8 @@ namespace simply {
     public:
         /* === Public Class Declarations === ======================== */
         class id;
+
+        class Attributes;
         
         #if SIMPLY_WINDOWS
             ///   Priority
@@ -94,8 +424,68 @@ namespace simply {
                 HIGHEST       = THREAD_PRIORITY_HIGHEST,
                 TIME_CRITICAL = THREAD_PRIORITY_TIME_CRITICAL
             };
+
+        #elif SIMPLY_LINUX
+            ///   Policy {Linux}
+            /// The scheduling policies available on Linux
+            ///
+            /// FIFO and RR are real-time policies, taking a priority of 1-99,
+            /// the others only take a priority of 0. DEADLINE is set through
+            /// `Deadline` parameters instead of a priority
+            enum Policy {
+                OTHER    = SCHED_OTHER,
+                FIFO     = SCHED_FIFO,
+                RR       = SCHED_RR,
+                BATCH    = SCHED_BATCH,
+                IDLE     = SCHED_IDLE,
+                DEADLINE = SCHED_DEADLINE
+            };
+
+            ///   Deadline {Linux}
+            /// Parameters for Policy::DEADLINE - the thread is given `runtime`
+            /// of CPU time before `deadline`, once every `period`
+            ///
+            /// A `period` of 0 is the same as `deadline`
+            struct Deadline {
+                std::chrono::nanoseconds runtime;
+                std::chrono::nanoseconds deadline;
+                std::chrono::nanoseconds period;
+            };
         #endif
 
+        ///   QoS
+        /// How much a thread's speed matters against the power it draws, for both OSs
+        ///
+        /// For Windows, EFFICIENCY and BACKGROUND turn on EcoQoS and keep the
+        /// thread to the efficiency cores of a hybrid CPU, while LATENCY opts
+        /// out of power throttling. For Linux they set uclamp utilization
+        /// clamps, which steer the thread between big and little cores and
+        /// pick its CPU frequency, and the timer slack its wakeups may be
+        /// coalesced within. BACKGROUND is also Policy::IDLE (Priority::IDLE
+        /// for Windows), only running when nothing else would
+        enum QoS {
+            LATENCY,        // Fast cores at full speed, and precise timers
+            DEFAULT,        // Left to the OS
+            EFFICIENCY,     // Efficiency cores, throttled, with coalesced wakeups
+            BACKGROUND      // As EFFICIENCY, at the lowest priority
+        };
+
+        ///   Stats
+        /// CPU time and scheduling counters of a thread, 0 where the OS doesn't provide them
+        struct Stats {
+            std::chrono::nanoseconds cpu_time;      // Total time running on a CPU
+            std::chrono::nanoseconds user_time;
+            std::chrono::nanoseconds system_time;
+            std::chrono::nanoseconds wait_time;     // {Linux} Time runnable, but waiting for a CPU
+            uint64_t voluntary_switches;            // {Linux} Blocked or slept
+            uint64_t involuntary_switches;          // {Linux} Preempted
+            uint64_t minor_faults;                  // {Linux} Page faults served without I/O
+            uint64_t major_faults;                  // {Linux} Page faults that had to read from disk
+            uint64_t cycles;                        // {Windows} CPU clock cycles used
+            size_t cpu;                             // CpuSet index of the current (or last) CPU
+        };
+
+
     public:
         /* === Classes Implementations === ========================== */
         ///   id
@@ -155,14 +545,35 @@ namespace simply {
 
         ///   Constructor
         /// @brief Create and immediately execute on new thread
-        template <class F, class... Args>
+        ///
+        /// While the ThreadCache is enabled, this runs on a parked thread if there is one
+        template <class F, class... Args, std::enable_if_t<!_is_thread_option<F>::value, int> = 0>
         Thread(F&& f, Args&&... args);
 
+        ///   Constructor
+        /// @brief Create a thread with all of `attributes` applied before `f` starts executing
+        /// @throws
+        ///  - system_error if any attribute could not be applied, in which case no thread is left running
+        template <class F, class... Args>
+        Thread(const Attributes& attributes, F&& f, Args&&... args);
+
         ///   Constructor
         /// @brief Create and immediately execute on new thread
+        ///
+        /// `stack_size` is rounded up to whole pages, and for Linux to at
+        /// least `PTHREAD_STACK_MIN`. A `stack_size` of 0 uses the system default.
         template <class F, class... Args>
         Thread(size_t stack_size, F&& f, Args&&... args);
 
+        #if SIMPLY_LINUX
+            ///   Constructor {Linux}
+            /// @brief Create and immediately execute on new thread, using a stack from `stack_pool`
+            ///
+            /// The stack is returned to the pool once the thread is joined
+            template <class F, class... Args>
+            Thread(StackPool& stack_pool, F&& f, Args&&... args);
+        #endif
+
         ///   Destructor {blocking}
         /// @brief Will join if joinable
         ~Thread();
@@ -211,16 +622,26 @@ namespace simply {
 
         ///   join_for {timed}
         /// @brief Timed join using standard chrono library
+        ///
+        /// This is a single wait on a steady_clock deadline, at up to
+        /// nanosecond resolution, so it is unaffected by changes to the
+        /// wall clock
         template <class Rep, class Period>
         bool join_for(const std::chrono::duration<Rep, Period>& timeout_duration);
 
         ///   join_until {timed}
         /// @brief Timed join, returning if thread hasn't joined by timepoint
+        ///
+        /// steady_clock timepoints take a single wait, other clocks are
+        /// re-checked whenever the wait times out. A timepoint that has
+        /// passed still joins a thread that has already finished.
         template <class Clock, class Duration>
         bool join_until(const std::chrono::time_point<Clock, Duration>& timeout_time);
 
         ///   detach
         /// @brief Let thread execute independently of this object
+        /// @throws
+        ///  - system_error(operation_not_permitted) if running on a StackPool stack
         void detach();
 
         /* === More Options === ======================================*/
@@ -245,6 +666,73 @@ namespace simply {
 
         #endif
 
+        ///   set_affinity
+        /// @brief Restrict this thread to run only on the CPUs in `cpus`
+        /// @throws
+        ///  - system_error(invalid_argument) if `cpus` is empty
+        ///  - system_error(invalid_argument) {Windows} if `cpus` spans more than one processor group
+        ///  - system_error if system API calls failed
+        void set_affinity(const CpuSet& cpus);
+
+        ///   get_affinity
+        /// @brief Get the CPUs this thread may run on
+        CpuSet get_affinity() const;
+
+        #if SIMPLY_WINDOWS
+            ///   set_priority {Windows}
+            /// @brief Set the priority of this thread
+            void set_priority(Priority priority);
+
+            ///   get_priority {Windows}
+            /// @brief Get the priority of this thread
+            Priority get_priority() const;
+
+        #elif SIMPLY_LINUX
+            ///   set_scheduling {Linux}
+            /// @brief Set the scheduling policy of this thread, and its priority
+            ///
+            /// Raising the policy to FIFO or RR needs CAP_SYS_NICE (or RLIMIT_RTPRIO)
+            /// @throws
+            ///  - system_error(invalid_argument) if `priority` is out of range for `policy`
+            ///  - system_error(invalid_argument) for Policy::DEADLINE - see this_thread::set_deadline
+            ///  - system_error(operation_not_permitted) if not privileged to do so
+            void set_scheduling(Policy policy, int priority = 0);
+
+            ///   get_policy {Linux}
+            /// @brief Get the scheduling policy of this thread
+            Policy get_policy() const;
+
+            ///   get_priority {Linux}
+            /// @brief Get the (real-time) priority of this thread, 0 if not FIFO or RR
+            int get_priority() const;
+        #endif
+
+        ///   set_qos
+        /// @brief Set the quality of service of this thread
+        ///
+        /// Leaving BACKGROUND puts the thread back under Policy::OTHER
+        /// (Priority::NORMAL for Windows). For Linux, another thread's timer
+        /// slack can only be changed with CAP_SYS_NICE, and is left as it is
+        /// without - this_thread::set_qos and Attributes::qos always set it
+        /// @throws
+        ///  - system_error(operation_not_permitted) {Linux} if leaving BACKGROUND isn't allowed by RLIMIT_NICE
+        ///  - system_error if system API calls failed
+        void set_qos(QoS qos);
+
+        ///   get_qos
+        /// @brief Get the quality of service of this thread, as read back from its settings
+        QoS get_qos() const;
+
+        ///   stats
+        /// @brief Sample the CPU time and scheduling counters of this thread
+        ///
+        /// Linux reads /proc/self/task/<tid>, so user/system times are in
+        /// clock ticks. Windows has no switch counts, and reports the
+        /// thread's ideal processor as `cpu`.
+        /// @throws
+        ///  - system_error if system API calls failed
+        Stats stats() const;
+
         /* === Stop Token Support === =============================== */
         #if SIMPLY_std20plus
             ///   get_stop_source {C++ std >= 20}
@@ -282,8 +770,9 @@ namespace simply {
         /// This will "fail silently" according to standard's requirements,
         /// so a value of `0` is returned if this cannot be retrieved.
         ///
-        /// For Windows, the max value returned here will be 64, even
-        /// if more than 64 threads are supported.
+        /// For Windows, this counts every processor group, so is not
+        /// capped at 64. See `topology()` in topology.h for cores,
+        /// caches and NUMA nodes.
         static unsigned int hardware_concurrency() noexcept;
 
         ///   max_sleep
@@ -301,13 +790,210 @@ namespace simply {
         // To ensure proper cleanup
         void _reset();
 
+        // All timed joins end up here, with the thread already checked joinable
+        bool _join_until(std::chrono::steady_clock::time_point deadline);
+
+        // Joins on a ThreadCache thread, which only waits for the function to return
+        bool _standby_join_until(std::chrono::steady_clock::time_point deadline);
+
+        // Every constructor but the cached one ends up here
+        template <class F, class... Args>
+        void _construct(const Attributes& attributes, F&& f, Args&&... args);
+
+        // Hands `f` to a ThreadCache thread, parked or new
+        template <class F, class... Args>
+        void _construct_standby(F&& f, Args&&... args);
+
+        #if SIMPLY_LINUX
+            // Kernel id of the thread, for what pthreads has no call for
+            pid_t _tid() const noexcept;
+        #endif
+
         native_handle_type handle_;  
 
+        // Set if running on a ThreadCache thread, which is waited on instead of joined
+        _StandbyWorker* standby_;
+
         #if SIMPLY_std20plus
             std::stop_source stop_source_;
         #endif
+
+        #if SIMPLY_LINUX
+            // Recorded by the thread as it started - 0 on a ThreadCache thread, which keeps its own
+            pid_t tid_;
+
+            // Set if the stack was taken from a StackPool
+            StackPool* stack_pool_;
+            void* stack_;
+        #endif
+    };
+
+    // =================================================================
+    // >> Thread::Attributes
+    // =================================================================
+    ///   Thread::Attributes
+    /// @brief Everything to set up on a new thread before it starts executing
+    ///
+    /// For Linux, these are passed to pthread_create, except the name which
+    /// the new thread sets itself. For Windows, the thread is created suspended,
+    /// and resumed once these are applied.
+    ///
+    /// ```c++
+    /// Thread t(Thread::Attributes().name("decoder").affinity(CpuSet({2})), decode_loop);
+    /// ```
+    class Thread::Attributes {
+    public:
+        /* === Setters === ========================================== */
+        ///   stack_size
+        /// @brief Bytes of stack to reserve, 0 (default) for the system default
+        Attributes& stack_size(size_t bytes) noexcept;
+
+        ///   guard_size {Linux}
+        /// @brief Bytes of guard below the stack, 0 (default) for the system default
+        ///
+        /// Ignored for Windows, and when using a stack_pool
+        Attributes& guard_size(size_t bytes) noexcept;
+
+        #if SIMPLY_LINUX
+            ///   stack_pool {Linux}
+            /// @brief Take the stack from `pool`, overriding stack_size and guard_size
+            Attributes& stack_pool(StackPool& pool) noexcept;
+        #endif
+
+        ///   affinity
+        /// @brief CPUs the thread may run on
+        Attributes& affinity(const CpuSet& cpus);
+
+        #if SIMPLY_WINDOWS
+            ///   priority {Windows}
+            Attributes& priority(Priority priority) noexcept;
+
+        #elif SIMPLY_LINUX
+            ///   scheduling {Linux}
+            /// @brief Scheduling policy, and its priority
+            /// @throws
+            ///  - system_error(invalid_argument) if `priority` is out of range for `policy`
+            ///  - system_error(invalid_argument) for Policy::DEADLINE - use deadline
+            Attributes& scheduling(Policy policy, int priority = 0);
+
+            ///   deadline {Linux}
+            /// @brief Run under Policy::DEADLINE with these parameters, replacing any scheduling
+            /// @throws
+            ///  - system_error(invalid_argument) unless runtime <= deadline <= period
+            Attributes& deadline(std::chrono::nanoseconds runtime, std::chrono::nanoseconds deadline, std::chrono::nanoseconds period = {});
+
+            ///   nice {Linux}
+            /// @brief Nice value of the thread, from -20 (most CPU) to 19 (least)
+            ///
+            /// Only OTHER and BATCH threads are affected by it
+            /// @throws
+            ///  - system_error(invalid_argument) if out of range
+            Attributes& nice(int nice);
+        #endif
+
+        ///   qos
+        /// @brief Quality of service of the thread, applied before the thread function runs
+        ///
+        /// Applied before the scheduling, priority and nice, so those win where they overlap
+        Attributes& qos(QoS qos) noexcept;
+
+        ///   name
+        /// @brief Human-readable name for the thread
+        /// @throws
+        ///  - system_error(invalid_argument) if too long (>15 char for Linux)
+        Attributes& name(const std::string& name);
+
+        ///   arena
+        /// @brief Give the thread its own Arena of `block_size` blocks, as `this_thread::arena()`
+        ///
+        /// Made before the thread function runs, and freed with all of its
+        /// memory once the function returns. 0 (default) gives it none.
+        Attributes& arena(size_t block_size) noexcept;
+
+        ///   prefault_stack
+        /// @brief Touch, and lock into RAM, the top `bytes` of the stack before the thread function runs
+        ///
+        /// For threads that must not take a page fault once started: the
+        /// stack they will use is made resident and pinned with mlock
+        /// (VirtualLock for Windows), so the first calls into it don't fault.
+        /// Pair it with lock_memory for the heap. 0 (default) does neither.
+        ///
+        /// Starting the thread throws system_error if the stack can't be
+        /// locked - e.g. past RLIMIT_MEMLOCK - or `bytes` doesn't fit in it.
+        Attributes& prefault_stack(size_t bytes) noexcept;
+
+        /* === Getters === ========================================== */
+        size_t stack_size() const noexcept;
+
+        size_t guard_size() const noexcept;
+
+        #if SIMPLY_LINUX
+            StackPool* stack_pool() const noexcept;
+        #endif
+
+        const std::optional<CpuSet>& affinity() const noexcept;
+
+        #if SIMPLY_WINDOWS
+            const std::optional<Priority>& priority() const noexcept;
+
+        #elif SIMPLY_LINUX
+            const std::optional<Policy>& policy() const noexcept;
+
+            int priority() const noexcept;
+
+            const std::optional<Deadline>& deadline() const noexcept;
+
+            const std::optional<int>& nice() const noexcept;
+        #endif
+
+        const std::optional<QoS>& qos() const noexcept;
+
+        const std::string& name() const noexcept;
+
+        ///   arena
+        /// @brief Block size of the thread's Arena, 0 if it has none
+        size_t arena() const noexcept;
+
+        ///   prefault_stack
+        /// @brief Bytes of stack made resident before the thread function runs, 0 if none
+        size_t prefault_stack() const noexcept;
+
+    private:
+        size_t stack_size_ = 0;
+        size_t guard_size_ = 0;
+
+        #if SIMPLY_LINUX
+            StackPool* stack_pool_ = nullptr;
+        #endif
+
+        std::optional<CpuSet> affinity_;
+
+        #if SIMPLY_WINDOWS
+            std::optional<Priority> priority_;
+
+        #elif SIMPLY_LINUX
+            std::optional<Policy> policy_;
+            int priority_ = 0;
+            std::optional<Deadline> deadline_;
+            std::optional<int> nice_;
+        #endif
+
+        std::optional<QoS> qos_;
+        std::string name_;
+        size_t arena_ = 0;
+        size_t prefault_stack_ = 0;
     };
 
+    template <class F>
+    struct _is_thread_option: std::bool_constant<
+        std::is_integral_v<std::decay_t<F>> ||
+        std::is_same_v<std::decay_t<F>, Thread> ||
+        std::is_same_v<std::decay_t<F>, Thread::Attributes>
+        #if SIMPLY_LINUX
+            || std::is_same_v<std::decay_t<F>, StackPool>
+        #endif
+    > {};
+
     // =================================================================
     // >> this_thread
     // =================================================================
@@ -316,12 +1002,35 @@ namespace simply {
     namespace this_thread {
         ///   get_id
         /// @brief Get an identifier for this thread
+        ///
+        /// Like get_name, get_affinity and the priority getters, this is read
+        /// from the OS once and then cached for the thread, so repeat calls -
+        /// such as from logging - are plain loads. Changes made through
+        /// simply-threading, from any thread, are seen; changes made around
+        /// it, such as by taskset, are not.
         Thread::id get_id() noexcept;
 
+        #if SIMPLY_std20plus
+            ///   get_stop_token {C++ std >= 20}
+            /// @brief The stop token of the simply::Thread running this, whether or not its function takes it
+            ///
+            /// One that can never be stopped on other threads, such as main
+            std::stop_token get_stop_token() noexcept;
+        #endif
+
         ///   yield
         /// @brief Allow OS to yield to another thread of execution
         void yield() noexcept;
 
+        ///   relax
+        /// @brief Pause briefly inside a spin-wait loop, without giving up the CPU
+        ///
+        /// Issues `tpause` where the CPU has WAITPKG, `pause` on other x86
+        /// and `yield` on ARM - each lets an SMT sibling run meanwhile and
+        /// avoids the memory-order mis-speculation when the loop exits.
+        /// Unlike `yield()`, no system call is made.
+        void relax() noexcept;
+
         ///   sleep
         /// @brief Sleep for a specified number of milliseconds
         /// @throws
@@ -330,21 +1039,68 @@ namespace simply {
         void sleep(ms_type ms_sleep);
 
         ///   sleep_until
-        /// @brief Sleep until a specified clock timepoint
+        /// @brief Sleep until a specified clock timepoint, returning at once if it has passed
+        ///
+        /// steady_clock and system_clock timepoints are slept on directly
+        /// (Linux: clock_nanosleep with TIMER_ABSTIME), so a loop advancing
+        /// its deadline by a fixed period does not drift. Other clocks are
+        /// re-checked after each wake up.
         /// @throws 
-        ///  - system_error(invalid_argument) if duration is negative
-        ///  - system_error(invalid_argument) if duration is too large - see Thread::max_sleep
+        ///  - system_error if system API calls failed
         template <class Clock, class Duration>
         void sleep_until(const std::chrono::time_point<Clock, Duration>& abs_time);
 
+        ///   sleep_until {hybrid}
+        /// @brief Sleep until `spin` before `abs_time`, then busy-wait until it
+        ///
+        /// Keeps wake up jitter to a few microseconds, at the cost of a CPU
+        /// for up to `spin` per call
+        /// @throws 
+        ///  - system_error(invalid_argument) if `spin` is negative
+        ///  - system_error if system API calls failed
+        template <class Clock, class Duration>
+        void sleep_until(const std::chrono::time_point<Clock, Duration>& abs_time, std::chrono::nanoseconds spin);
+
         ///   sleep_for
-        /// @brief Sleep for a specified clock duration
+        /// @brief Sleep for a specified clock duration, at up to nanosecond resolution
         /// @throws
         ///  - system_error(invalid_argument) if duration is negative
-        ///  - system_error(invalid_argument) if duration is too large - see Thread::max_sleep
+        ///  - system_error if system API calls failed
         template <class Rep, class Period>
         void sleep_for(const std::chrono::duration<Rep, Period>& rel_time);
 
+        ///   sleep_for {hybrid}
+        /// @brief Sleep for `rel_time` - see sleep_until {hybrid}
+        /// @throws
+        ///  - system_error(invalid_argument) if duration or `spin` is negative
+        ///  - system_error if system API calls failed
+        template <class Rep, class Period>
+        void sleep_for(const std::chrono::duration<Rep, Period>& rel_time, std::chrono::nanoseconds spin);
+
+        #if SIMPLY_std20plus
+            ///   sleep_until {stoppable} {C++ std >= 20}
+            /// @brief Sleep until `abs_time`, or until a stop is requested on `token`
+            ///
+            /// Wakes as soon as the stop is requested, rather than polling
+            /// (Linux: a futex, Windows: an event alongside the timer). Other
+            /// clocks than steady_clock are re-checked after each wake up.
+            /// @returns `true` if slept until `abs_time`, `false` if a stop was requested
+            /// @throws
+            ///  - system_error if system API calls failed
+            template <class Clock, class Duration>
+            bool sleep_until(const std::chrono::time_point<Clock, Duration>& abs_time, const std::stop_token& token);
+
+            ///   sleep_for {stoppable} {C++ std >= 20}
+            /// @brief Sleep for `rel_time`, or until a stop is requested on `token` - see sleep_until {stoppable}
+            /// @returns `true` if slept for `rel_time`, `false` if a stop was requested
+            /// @throws
+            ///  - system_error(invalid_argument) if duration is negative
+            ///  - system_error if system API calls failed
+            template <class Rep, class Period>
+            bool sleep_for(const std::chrono::duration<Rep, Period>& rel_time, const std::stop_token& token);
+
+        #endif
+
         ///   set_name
         /// @brief Set the human-readable name for this thread
         /// @throws
@@ -374,23 +1130,273 @@ namespace simply {
         #endif
 
         #if SIMPLY_WINDOWS    
+            ///   set_priority {Windows}
+            /// @brief Set the priority of the current thread
+            void set_priority(Thread::Priority priority);
+
             ///   get_priority
             /// @brief Get the priority of the current thread
             Thread::Priority get_priority();
-        #endif
 
-        // "Suppress" until a good workaround found through cmake
-        /// @todo - Fix the get_stack_size C++ implementation
-        // #if !(defined(SIMPLY_WIN_7) && SIMPLY_WINDOWS)
-        //     ///   get_stack_size
+        #elif SIMPLY_LINUX
+            ///   set_scheduling {Linux}
+            /// @brief Set the scheduling policy of the current thread, and its priority
+            /// @throws
+            ///  - system_error(invalid_argument) if `priority` is out of range for `policy`
+            ///  - system_error(invalid_argument) for Policy::DEADLINE - use set_deadline
+            ///  - system_error(operation_not_permitted) if not privileged to do so
+            void set_scheduling(Thread::Policy policy, int priority = 0);
+
+            ///   set_deadline {Linux}
+            /// @brief Run the current thread under Policy::DEADLINE
+            ///
+            /// Needs CAP_SYS_NICE, and the thread's affinity must cover every
+            /// CPU of its scheduling domain
+            /// @throws
+            ///  - system_error(invalid_argument) unless runtime <= deadline <= period
+            ///  - system_error(busy) if the kernel can't admit this much runtime
+            ///  - system_error if system API calls failed
+            void set_deadline(std::chrono::nanoseconds runtime, std::chrono::nanoseconds deadline, std::chrono::nanoseconds period = {});
+
+            ///   get_policy {Linux}
+            /// @brief Get the scheduling policy of the current thread
+            Thread::Policy get_policy();
+
+            ///   get_priority {Linux}
+            /// @brief Get the (real-time) priority of the current thread, 0 if not FIFO or RR
+            int get_priority();
+
+            ///   set_nice {Linux}
+            /// @brief Set the nice value of the current thread, from -20 (most CPU) to 19 (least)
+            ///
+            /// Lowering it needs CAP_SYS_NICE (or RLIMIT_NICE)
+            /// @throws
+            ///  - system_error(invalid_argument) if out of range
+            ///  - system_error(permission_denied) if not privileged to do so
+            void set_nice(int nice);
+
+            ///   get_nice {Linux}
+            /// @brief Get the nice value of the current thread
+            int get_nice();
+        #endif
+
+        ///   set_qos
+        /// @brief Set the quality of service of the current thread, as Thread::set_qos
+        /// @throws
+        ///  - system_error(operation_not_permitted) {Linux} if leaving BACKGROUND isn't allowed by RLIMIT_NICE
+        ///  - system_error if system API calls failed
+        void set_qos(Thread::QoS qos);
+
+        ///   get_qos
+        /// @brief Get the quality of service of the current thread
+        Thread::QoS get_qos();
+
+        ///   stats
+        /// @brief Sample the CPU time and scheduling counters of the current thread
+        ///
+        /// Cheaper and more precise than Thread::stats, as Linux can use
+        /// getrusage(RUSAGE_THREAD) instead of /proc
+        /// @throws
+        ///  - system_error if system API calls failed
+        Thread::Stats stats();
+
+        ///   set_affinity
+        /// @brief Restrict the current thread to run only on the CPUs in `cpus`
+        /// @throws
+        ///  - system_error(invalid_argument) if `cpus` is empty
+        ///  - system_error(invalid_argument) {Windows} if `cpus` spans more than one processor group
+        ///  - system_error if system API calls failed
+        void set_affinity(const CpuSet& cpus);
+
+        ///   get_affinity
+        /// @brief Get the CPUs the current thread may run on
+        CpuSet get_affinity();
+
+        ///   arena
+        /// @brief The current thread's Arena, `nullptr` unless started with `Thread::Attributes::arena`
+        Arena* arena() noexcept;
+
+        // "Suppress" until a good workaround found through cmake
+        /// @todo - Fix the get_stack_size C++ implementation
+        // #if !(defined(SIMPLY_WIN_7) && SIMPLY_WINDOWS)
+        //     ///   get_stack_size
         //     /// @brief Get the number of bytes reserved for/allocated to the current thread
         //     /// @note {Windows} This is only available for Windows SDK 8+, and may need compilation flags depending on compiler
         //     size_t get_stack_size();
         // #endif
-
-        // To add:
-        // xx CPU affinity xx can't GET CPU affinity... Can only set...
     }
+
+    // =================================================================
+    // >> ThreadRegistry
+    // =================================================================
+    ///   ThreadInfo
+    /// @brief A registered thread, as seen by ThreadRegistry::snapshot
+    struct ThreadInfo {
+        Thread::id id;
+        uint64_t os_id;         // Linux: tid, Windows: thread id - as shown by top, gdb, Task Manager...
+        std::string name;       // Cached when started or renamed, so reading it needs no system call
+        std::chrono::system_clock::time_point started;
+        Thread::Stats stats;    // Only sampled by snapshot(true)
+
+        ///   attributes
+        /// @brief The Thread::Attributes the thread was started with
+        ///
+        /// Default for threads started without any, such as on a parked
+        /// ThreadCache thread. The stack_pool is not kept, as it may be
+        /// gone by the time this is read.
+        Thread::Attributes attributes;
+
+        ///   sample_stats
+        /// @brief Sample the thread's Stats now, without taking another snapshot
+        ///
+        /// Zeroes once the thread has exited - though the OS may then have
+        /// handed its `os_id` to a newer thread
+        Thread::Stats sample_stats() const noexcept;
+    };
+
+    ///   ThreadRegistry
+    /// @brief Opt-in registry of the live threads started by `simply::Thread`
+    ///
+    /// While enabled, new threads add themselves before running their
+    /// function, and remove themselves once it returns. Threads only
+    /// write their own entry, and snapshots only read, so neither ever
+    /// waits on the other.
+    class ThreadRegistry {
+    public:
+        ///   enable
+        /// @brief Register threads started from now on, or stop registering them
+        ///
+        /// Threads that are already registered stay so until they exit
+        static void enable(bool enabled = true) noexcept;
+
+        ///   enabled
+        static bool enabled() noexcept;
+
+        ///   size
+        /// @brief Number of registered threads
+        static size_t size() noexcept;
+
+        ///   snapshot
+        /// @brief Copy out every registered thread, optionally also sampling its Stats
+        static std::vector<ThreadInfo> snapshot(bool with_stats = false);
+
+        ///   dump
+        /// @brief Write one line per registered thread to file descriptor `fd`
+        ///
+        /// Allocates nothing and takes no locks, so it is safe to call from
+        /// a signal handler, such as for SIGUSR1. An entry that stays
+        /// mid-update, such as that of the interrupted thread, is written
+        /// as "? busy" rather than waited on
+        static void dump(int fd) noexcept;
+    };
+
+    // =================================================================
+    // >> Trace
+    // =================================================================
+    ///   Trace
+    /// @brief Thread lifecycle, sleep and wait events, written out as Chrome trace / Perfetto JSON
+    ///
+    /// Compiled in with SIMPLY_TRACE=1, and otherwise `write` gives an empty
+    /// trace. Each thread records into its own ring of the last `buffer_events`
+    /// events - a TSC read and a few plain stores, with no locks or atomic
+    /// read-modify-writes. Threads only write their own ring, and `write`
+    /// only reads, dropping any event overwritten while it was being read.
+    ///
+    /// Recorded are threads running, spawning, joining and being asked to
+    /// stop, sleeps, and waits in sync.h that actually park. Add your own with
+    /// SIMPLY_TRACE_SCOPE("stage") and SIMPLY_TRACE_INSTANT("event").
+    ///
+    /// A thread's ring, and its name from set_name, outlive the thread until
+    /// a new thread reuses it, so finished threads still show up.
+    ///
+    /// ```c++
+    /// std::ofstream out("trace.json");
+    /// simply::Trace::write(out); // Open in ui.perfetto.dev or chrome://tracing
+    /// ```
+    class Trace {
+    public:
+        ///   enabled
+        /// @brief Whether tracing was compiled in
+        static constexpr bool enabled = SIMPLY_TRACE;
+
+        ///   buffer_events
+        /// @brief Events kept per thread, older ones are overwritten
+        static constexpr size_t buffer_events = 4096;
+
+        ///   write
+        /// @brief Write every thread's events as Chrome trace JSON
+        static void write(std::ostream& out);
+
+        ///   clear
+        /// @brief Forget every event recorded so far
+        static void clear() noexcept;
+    };
+
+    // =================================================================
+    // >> Memory locking
+    // =================================================================
+    ///   lock_memory
+    /// @brief Lock every page of the process into RAM, and with `future`, every page mapped later
+    ///
+    /// With `future`, new heap and stacks are made resident as they are
+    /// mapped, so they never fault on first touch either - which includes
+    /// all of each new thread's stack, so keep stack_size small. For Windows, which
+    /// has no such mode, the pages committed now are locked with VirtualLock
+    /// after growing the working set to hold them, and `future` is ignored.
+    /// @throws
+    ///  - system_error(operation_not_permitted) without the privilege to lock memory (CAP_IPC_LOCK for Linux)
+    ///  - system_error(not_enough_memory) if the pages exceed RLIMIT_MEMLOCK, or the working set quota
+    void lock_memory(bool future = true);
+
+    ///   unlock_memory
+    /// @brief Undo lock_memory
+    void unlock_memory() noexcept;
+
+    // =================================================================
+    // >> ThreadCache
+    // =================================================================
+    ///   ThreadCache
+    /// @brief Opt-in, process-wide standby threads for `Thread(f, args...)` to run on instead of spawning
+    ///
+    /// While enabled, a thread started by that constructor doesn't exit once
+    /// its function returns: it parks on a futex (WaitOnAddress for Windows),
+    /// and the next such Thread hands its function over with one wakeup,
+    /// instead of creating an OS thread. `join` returns once the function does.
+    ///
+    /// The Thread still has a thread to itself until joined or detached -
+    /// only then is it parked - so `native_handle`, `get_id` and all the
+    /// setters act on it as usual. Whatever the function changed on its own
+    /// thread (name, affinity, scheduling, nice, QoS, timer slack) is undone
+    /// before it is reused, and a thread where that is refused exits instead.
+    /// `thread_local` variables live on from one function to the next, as
+    /// do the OS's counters: `stats()` of a reused thread includes the CPU
+    /// time, faults and switches of every function it ran before.
+    ///
+    /// Threads started with Attributes, a stack size or a StackPool always
+    /// get a new thread, as they ask for one set up differently.
+    class ThreadCache {
+    public:
+        ///   Stats
+        struct Stats {
+            uint64_t spawned;   // Threads created to run on, then park
+            uint64_t reused;    // Functions run on a parked thread
+            size_t parked;      // Threads parked now
+        };
+
+        ///   enable
+        /// @brief Keep up to `max_parked` threads parked, each exiting if not reused within `idle_timeout`
+        static void enable(size_t max_parked = 64, std::chrono::milliseconds idle_timeout = std::chrono::seconds(10));
+
+        ///   disable
+        /// @brief Stop caching threads - those parked exit, and running ones do once joined
+        static void disable() noexcept;
+
+        ///   enabled
+        static bool enabled() noexcept;
+
+        ///   stats
+        static Stats stats() noexcept;
+    };
 }
 
 // =====================================================================
@@ -398,215 +1404,2758 @@ namespace simply {
 // =====================================================================
 namespace simply {
     // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // ++ Thread::id
+    // ++ Wait on address
     // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // 0 should never be expected for a thread on most modern OSs
-    Thread::id::id() noexcept: id_(0) {}
-
-    // Failure should not be expected on most modern OSs
+    // Thin wrappers over futex/WaitOnAddress - waits may return spuriously,
+    // so callers must re-check the word in a loop.
+    // Wakes only use the word's address, so they are safe on words that
+    // may have just gone out of scope.
     #if SIMPLY_WINDOWS
-        Thread::id::id(Thread::native_handle_type handle) noexcept: id_(GetThreadId(handle)) {}
-    
+        inline void _futex_wait(std::atomic<uint32_t>& word, uint32_t expected) noexcept {
+            WaitOnAddress(&word, &expected, sizeof(expected), INFINITE);
+        }
+
+        inline void _futex_wake_one(std::atomic<uint32_t>& word) noexcept {
+            WakeByAddressSingle(&word);
+        }
+
+        inline void _futex_wake_all(std::atomic<uint32_t>& word) noexcept {
+            WakeByAddressAll(&word);
+        }
+
     #elif SIMPLY_LINUX
-        Thread::id::id(Thread::native_handle_type handle) noexcept: id_(handle) {}
+        inline void _futex_wait(std::atomic<uint32_t>& word, uint32_t expected) noexcept {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+        }
+
+        inline void _futex_wake_one(std::atomic<uint32_t>& word) noexcept {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+        }
+
+        inline void _futex_wake_all(std::atomic<uint32_t>& word) noexcept {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, std::numeric_limits<int>::max(), nullptr, nullptr, 0);
+        }
     #endif
 
-    bool operator==(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ == rhs.id_; }
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Sleeping
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // now() + `duration`, saturating instead of overflowing for huge durations
+    template <class Rep, class Period>
+    std::chrono::steady_clock::time_point _steady_deadline(const std::chrono::duration<Rep, Period>& duration) {
+        auto now = std::chrono::steady_clock::now();
+        if ( std::chrono::duration<double>(duration) >= std::chrono::duration<double>(std::chrono::steady_clock::time_point::max() - now) )
+            return std::chrono::steady_clock::time_point::max();
+        return now + std::chrono::ceil<std::chrono::steady_clock::duration>(duration);
+    }
 
-    #if SIMPLY_std20plus
-        std::strong_ordering operator<=>(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ <=> rhs.id_; }
+    // Hint to the CPU that this is a spin-wait loop
+    inline void _cpu_pause() noexcept {
+        #if SIMPLY_WINDOWS
+            YieldProcessor();
+        #elif defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+        #elif defined(__aarch64__) || defined(__arm__)
+            __asm__ __volatile__("yield");
+        #endif
+    }
+
+    // WAITPKG (tpause, umonitor/umwait) - these wait in the C0.1 state
+    // until a TSC deadline, or for umwait until the monitored line is
+    // written, handing the core to an SMT sibling meanwhile. GCC/Clang
+    // emit them as raw bytes, so no -mwaitpkg is needed.
+    #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        inline bool _cpu_has_waitpkg() noexcept {
+            static const bool has = [](){
+                int regs[4];
+                __cpuidex(regs, 7, 0);
+                return (regs[2] >> 5) & 1;
+            }();
+            return has;
+        }
+
+        inline void _cpu_tpause(uint64_t cycles) noexcept {
+            _tpause(1, __rdtsc() + cycles);
+        }
+
+        inline void _cpu_umwait(const void* address, uint64_t cycles) noexcept {
+            _umonitor(const_cast<void*>(address));
+            _umwait(1, __rdtsc() + cycles);
+        }
+        #define SIMPLY_WAITPKG 1
+
+    #elif defined(__x86_64__) || defined(__i386__)
+        inline bool _cpu_has_waitpkg() noexcept {
+            static const bool has = [](){
+                unsigned int eax, ebx, ecx, edx;
+                return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && ((ecx >> 5) & 1);
+            }();
+            return has;
+        }
+
+        inline void _cpu_tpause(uint64_t cycles) noexcept {
+            uint64_t deadline = __rdtsc() + cycles;
+            // tpause ecx
+            __asm__ __volatile__(".byte 0x66, 0x0f, 0xae, 0xf1"
+                :: "c"(1u), "a"(static_cast<uint32_t>(deadline)), "d"(static_cast<uint32_t>(deadline >> 32)) : "cc", "memory");
+        }
+
+        inline void _cpu_umwait(const void* address, uint64_t cycles) noexcept {
+            // umonitor rax
+            __asm__ __volatile__(".byte 0xf3, 0x0f, 0xae, 0xf0" :: "a"(address) : "memory");
+            uint64_t deadline = __rdtsc() + cycles;
+            // umwait ecx
+            __asm__ __volatile__(".byte 0xf2, 0x0f, 0xae, 0xf1"
+                :: "c"(1u), "a"(static_cast<uint32_t>(deadline)), "d"(static_cast<uint32_t>(deadline >> 32)) : "cc", "memory");
+        }
+        #define SIMPLY_WAITPKG 1
 
     #else
-        bool operator!=(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ != rhs.id_; } 
-        bool operator>(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ > rhs.id_; } 
-        bool operator<(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ < rhs.id_; }
-        bool operator<=(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ <= rhs.id_; } 
-        bool operator>=(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ >= rhs.id_; }
+        #define SIMPLY_WAITPKG 0
     #endif
 
-    template <class CharT, class Traits>
-    inline std::basic_ostream<CharT, Traits>&
-    operator<<(std::basic_ostream<CharT, Traits>& lhs, Thread::id rhs) { lhs << std::to_string(rhs.id_); return lhs; }
+    // TSC ticks per relax with tpause - about as long as a Skylake pause
+    constexpr uint64_t _relax_cycles = 200;
 
     // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    // ++ Thread
+    // ++ Trace
     // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // Each field is atomic, so that Trace::write racing the owner is only
+    // ever dropped, rather than undefined
+    struct _TraceEvent {
+        std::atomic<uint64_t> time{0};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<char> phase{0};
+    };
+
+    ///   _TraceBuffer {internal}
+    /// @brief One thread's ring of events - buffers are never freed, only reused
+    struct _TraceBuffer {
+        std::atomic<uint64_t> head{0};              // Only written by the owner
+        std::atomic<uint64_t> floor{0};             // Events before this were cleared
+        std::atomic<uint32_t> claimed{0};
+        std::atomic<Thread::id> id{Thread::id()};
+        std::atomic<uint64_t> os_id{0};
+        std::mutex name_mutex;
+        std::string name;
+        _TraceBuffer* next = nullptr;               // Fixed before the buffer is published
+        _TraceEvent events[Trace::buffer_events];
+    };
+
+    // TSC ticks where available, as steady_clock costs a vDSO call -
+    // Trace::write converts them against steady_clock
+    inline uint64_t _trace_clock() noexcept {
+        #if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+        #else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()
+            ).count());
+        #endif
+    }
+
+    inline _TraceBuffer*& _trace_self() noexcept {
+        thread_local _TraceBuffer* buffer = nullptr;
+        return buffer;
+    }
+
+    // First event on this thread - `nullptr` if out of memory
+    inline _TraceBuffer* _trace_acquire() noexcept;
+
+    inline void _trace_event(char phase, const char* name) noexcept {
+        _TraceBuffer* buffer = _trace_self();
+        if ( !buffer && !(buffer = _trace_acquire()) )
+            return;
+        uint64_t head = buffer->head.load(std::memory_order_relaxed);
+        _TraceEvent& event = buffer->events[head % Trace::buffer_events];
+        // Pairs with the fence in Trace::write, which then sees this event as overwritten
+        std::atomic_thread_fence(std::memory_order_release);
+        event.time.store(_trace_clock(), std::memory_order_relaxed);
+        event.name.store(name, std::memory_order_relaxed);
+        event.phase.store(phase, std::memory_order_relaxed);
+        buffer->head.store(head + 1, std::memory_order_release);
+    }
+
+    ///   _TraceScope {internal}
+    /// @brief Begins a span, and ends it with the scope
+    struct _TraceScope {
+        explicit _TraceScope(const char* name) noexcept: name(name) { _trace_event('B', name); }
+        ~_TraceScope() { _trace_event('E', name); }
+
+        _TraceScope(const _TraceScope&) = delete;
+        _TraceScope& operator=(const _TraceScope&) = delete;
+
+        const char* name;
+    };
+
+    #if SIMPLY_WINDOWS
+        #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+            #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+        #endif
+
+        // One high-resolution waitable timer per thread, created on first use
+        struct _SleepTimer {
+            HANDLE handle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+            ~_SleepTimer() { if ( handle ) CloseHandle(handle); }
+        };
+
+        // Arms the calling thread's timer to fire after `duration`,
+        // returning nullptr if high-resolution timers are unavailable
+        inline HANDLE _arm_sleep_timer(std::chrono::nanoseconds duration) noexcept {
+            thread_local _SleepTimer timer;
+            // Negative due times are relative, in 100ns units
+            LARGE_INTEGER due;
+            due.QuadPart = -std::max<long long>(1, (duration.count() + 99) / 100);
+            if ( timer.handle && SetWaitableTimer(timer.handle, &due, 0, nullptr, nullptr, FALSE) )
+                return timer.handle;
+            return nullptr;
+        }
+
+        inline void _sleep_relative(std::chrono::nanoseconds duration) {
+            if ( HANDLE timer = _arm_sleep_timer(duration) ) {
+                if ( WaitForSingleObject(timer, INFINITE) == WAIT_FAILED )
+                    throw std::system_error(GetLastError(), std::system_category());
+            }
+            else {
+                // Older than Windows 10 1803, so only millisecond sleeps
+                auto ms = std::chrono::ceil<std::chrono::milliseconds>(duration).count();
+                Sleep(static_cast<DWORD>(std::min<long long>(ms, Thread::max_sleep())));
+            }
+        }
+
+        inline void _sleep_until_steady(std::chrono::steady_clock::time_point deadline) {
+            SIMPLY_TRACE_SCOPE("sleep");
+            for ( auto now = std::chrono::steady_clock::now(); now < deadline; now = std::chrono::steady_clock::now() )
+                _sleep_relative(deadline - now);
+        }
+
+    #elif SIMPLY_LINUX
+        template <class Duration>
+        struct timespec _to_timespec(const Duration& since_epoch) noexcept {
+            auto ns = std::max<long long>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch).count());
+            struct timespec ts;
+            ts.tv_sec  = static_cast<time_t>(ns / 1000000000);
+            ts.tv_nsec = static_cast<long>(ns % 1000000000);
+            return ts;
+        }
+
+        // Restarted if interrupted by a signal, as the deadline is absolute
+        inline void _sleep_until(clockid_t clock, const struct timespec& deadline) {
+            while ( int err = clock_nanosleep(clock, TIMER_ABSTIME, &deadline, nullptr) )
+                if ( err != EINTR )
+                    throw std::system_error(err, std::system_category());
+        }
+
+        // steady_clock is CLOCK_MONOTONIC for both libstdc++ and libc++
+        inline void _sleep_until_steady(std::chrono::steady_clock::time_point deadline) {
+            SIMPLY_TRACE_SCOPE("sleep");
+            _sleep_until(CLOCK_MONOTONIC, _to_timespec(deadline.time_since_epoch()));
+        }
+    #endif
+
+    // Timed _futex_wait - returns `false` once `deadline` has passed, and
+    // may return `true` spuriously like _futex_wait
+    #if SIMPLY_WINDOWS
+        inline bool _futex_wait_until(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::steady_clock::time_point deadline) noexcept {
+            auto remaining = deadline - std::chrono::steady_clock::now();
+            if ( remaining.count() <= 0 )
+                return false;
+            auto ms = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+            DWORD timeout = static_cast<DWORD>(std::min<long long>(ms, INFINITE - 1));
+            return WaitOnAddress(&word, &expected, sizeof(expected), timeout) || GetLastError() != ERROR_TIMEOUT;
+        }
+
+    #elif SIMPLY_LINUX
+        inline bool _futex_wait_until(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::steady_clock::time_point deadline) noexcept {
+            // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC deadline
+            struct timespec timeout = _to_timespec(deadline.time_since_epoch());
+            long ret = syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_BITSET_PRIVATE, expected, &timeout, nullptr, FUTEX_BITSET_MATCH_ANY);
+            return !(ret == -1 && errno == ETIMEDOUT);
+        }
+    #endif
+
     #if SIMPLY_std20plus
-        #define TYPE_STOP_SOURCE const std::stop_source&
-    
-    #else
-        #define TYPE_STOP_SOURCE void* 
-    #endif 
+        // Sleeps until `deadline`, returning `false` early once a stop is
+        // requested on `token`. The stop_callback wakes the sleep from the
+        // requesting thread, and its destructor waits for a running callback.
+        #if SIMPLY_WINDOWS
+            // One manual-reset event per thread, set by the stop_callback
+            struct _StopEvent {
+                HANDLE handle = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+                ~_StopEvent() { if ( handle ) CloseHandle(handle); }
+            };
+
+            inline bool _sleep_until_steady(std::chrono::steady_clock::time_point deadline, const std::stop_token& token) {
+                SIMPLY_TRACE_SCOPE("sleep");
+                thread_local _StopEvent event;
+                if ( !event.handle )
+                    throw std::system_error(GetLastError(), std::system_category());
+                ResetEvent(event.handle);
+                HANDLE stop = event.handle;
+                std::stop_callback wake(token, [stop](){ SetEvent(stop); });
+
+                for ( auto now = std::chrono::steady_clock::now(); now < deadline; now = std::chrono::steady_clock::now() ) {
+                    DWORD ret;
+                    if ( HANDLE timer = _arm_sleep_timer(deadline - now) ) {
+                        HANDLE handles[2] = { stop, timer };
+                        ret = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+                    }
+                    else {
+                        auto ms = std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count();
+                        ret = WaitForSingleObject(stop, static_cast<DWORD>(std::min<long long>(ms, Thread::max_sleep())));
+                    }
+                    if ( ret == WAIT_FAILED )
+                        throw std::system_error(GetLastError(), std::system_category());
+                    if ( ret == WAIT_OBJECT_0 )
+                        return false;
+                }
+                return !token.stop_requested();
+            }
+
+        #elif SIMPLY_LINUX
+            inline bool _sleep_until_steady(std::chrono::steady_clock::time_point deadline, const std::stop_token& token) {
+                SIMPLY_TRACE_SCOPE("sleep");
+                std::atomic<uint32_t> stopped{0};
+                std::stop_callback wake(token, [&stopped](){
+                    stopped.store(1, std::memory_order_release);
+                    _futex_wake_all(stopped);
+                });
+                while ( !stopped.load(std::memory_order_acquire) )
+                    if ( !_futex_wait_until(stopped, 0, deadline) )
+                        return !stopped.load(std::memory_order_acquire);
+                return false;
+            }
+        #endif
+    #endif
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ CpuSet
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline CpuSet::CpuSet(std::initializer_list<size_t> cpus) {
+        for ( size_t cpu : cpus )
+            set(cpu);
+    }
+
+    inline CpuSet& CpuSet::set(size_t cpu) {
+        _ensure_valid(cpu, "set");
+        bits_.set(cpu);
+        return *this;
+    }
+
+    inline CpuSet& CpuSet::reset(size_t cpu) {
+        _ensure_valid(cpu, "reset");
+        bits_.reset(cpu);
+        return *this;
+    }
+
+    inline void CpuSet::clear() noexcept {
+        bits_.reset();
+    }
+
+    inline bool CpuSet::test(size_t cpu) const noexcept {
+        return cpu < max_cpus && bits_.test(cpu);
+    }
+
+    inline size_t CpuSet::count() const noexcept {
+        return bits_.count();
+    }
+
+    inline bool CpuSet::empty() const noexcept {
+        return bits_.none();
+    }
+
+    inline size_t CpuSet::first() const noexcept {
+        for ( size_t cpu = 0; cpu < max_cpus; cpu++ )
+            if ( bits_.test(cpu) )
+                return cpu;
+        return max_cpus;
+    }
+
+    inline bool operator==(const CpuSet& lhs, const CpuSet& rhs) noexcept { return lhs.bits_ == rhs.bits_; }
+
+    inline bool operator!=(const CpuSet& lhs, const CpuSet& rhs) noexcept { return lhs.bits_ != rhs.bits_; }
+
+    inline void CpuSet::_ensure_valid(size_t cpu, const std::string& called_from) const {
+        if ( cpu >= max_cpus )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "CpuSet::" + called_from + ": CPU index must be less than CpuSet::max_cpus!"
+            );
+    }
 
-    /* === Start Thread Wrappers === ++++++++++++++++++++++++++++++++ */
     #if SIMPLY_WINDOWS
-        #define THREAD_RETURN_TYPE unsigned __stdcall
-        #define SIMPLY_NULL_THREAD nullptr
-    
-    #elif SIMPLY_LINUX  
-        #define THREAD_RETURN_TYPE void*
-        #define SIMPLY_NULL_THREAD 0
+        inline GROUP_AFFINITY _to_group_affinity(const CpuSet& cpus) {
+            if ( cpus.empty() )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "set_affinity: CpuSet must not be empty!"
+                );
+            GROUP_AFFINITY affinity {0};
+            affinity.Group = static_cast<WORD>(cpus.first() / 64);
+            for ( size_t cpu = 0; cpu < CpuSet::max_cpus; cpu++ ) {
+                if ( !cpus.test(cpu) )
+                    continue;
+                if ( cpu / 64 != affinity.Group )
+                    throw std::system_error(
+                        std::make_error_code(std::errc::invalid_argument),
+                        "set_affinity: Windows threads can only be assigned CPUs from one processor group!"
+                    );
+                affinity.Mask |= KAFFINITY(1) << (cpu % 64);
+            }
+            return affinity;
+        }
+
+        inline void _set_affinity(HANDLE handle, const CpuSet& cpus) {
+            GROUP_AFFINITY affinity = _to_group_affinity(cpus);
+            if ( !SetThreadGroupAffinity(handle, &affinity, nullptr) )
+                throw std::system_error(GetLastError(), std::system_category());
+        }
+
+        inline CpuSet _get_affinity(HANDLE handle) {
+            GROUP_AFFINITY affinity {0};
+            if ( !GetThreadGroupAffinity(handle, &affinity) )
+                throw std::system_error(GetLastError(), std::system_category());
+            CpuSet cpus;
+            for ( size_t bit = 0; bit < 64; bit++ )
+                if ( affinity.Mask & (KAFFINITY(1) << bit) )
+                    cpus.set(affinity.Group * 64 + bit);
+            return cpus;
+        }
+
+    #elif SIMPLY_LINUX
+        inline cpu_set_t _to_cpu_set(const CpuSet& cpus) {
+            if ( cpus.empty() )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "set_affinity: CpuSet must not be empty!"
+                );
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for ( size_t cpu = 0; cpu < CpuSet::max_cpus && cpu < CPU_SETSIZE; cpu++ )
+                if ( cpus.test(cpu) )
+                    CPU_SET(cpu, &set);
+            return set;
+        }
+
+        inline CpuSet _from_cpu_set(const cpu_set_t& set) {
+            CpuSet cpus;
+            for ( size_t cpu = 0; cpu < CpuSet::max_cpus && cpu < CPU_SETSIZE; cpu++ )
+                if ( CPU_ISSET(cpu, &set) )
+                    cpus.set(cpu);
+            return cpus;
+        }
+
+        inline void _set_affinity(pthread_t thread, const CpuSet& cpus) {
+            cpu_set_t set = _to_cpu_set(cpus);
+            if ( int err = pthread_setaffinity_np(thread, sizeof(set), &set) )
+                throw std::system_error(err, std::system_category());
+        }
+
+        inline CpuSet _get_affinity(pthread_t thread) {
+            cpu_set_t set;
+            if ( int err = pthread_getaffinity_np(thread, sizeof(set), &set) )
+                throw std::system_error(err, std::system_category());
+            return _from_cpu_set(set);
+        }
     #endif
-    
-    template <class T, size_t... I>
-    THREAD_RETURN_TYPE _invoke(void* lparg) noexcept {
-        const std::unique_ptr<T> arg_ptr(static_cast<T*>(lparg));
-        T& args = *arg_ptr;
-        std::invoke(std::move(std::get<I>(args))...);
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Arena
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline ArenaResource::ArenaResource(Arena& arena) noexcept: arena_(&arena) {}
+
+    inline Arena& ArenaResource::arena() const noexcept {
+        return *arena_;
+    }
+
+    inline void* ArenaResource::do_allocate(size_t bytes, size_t alignment) {
+        return arena_->allocate(bytes, alignment);
+    }
+
+    inline void ArenaResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+        arena_->deallocate(p, bytes, alignment);
+    }
+
+    inline bool ArenaResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+    inline Arena::Arena(size_t block_size) noexcept:
+        block_size_(std::max(block_size, _small_max * 4)),
+        resource_(*this)
+    {}
+
+    inline Arena::~Arena() {
+        _free_blocks(blocks_);
+        _free_blocks(spare_);
+    }
+
+    inline void* Arena::allocate(size_t bytes, size_t alignment) {
+        if ( bytes <= _small_max && alignment <= _small_step ) {
+            // Rounded up to its class, and always 16-aligned, so any later
+            // allocation of the class can reuse it
+            size_t index = bytes ? (bytes - 1) / _small_step : 0;
+            if ( void* p = free_[index] ) {
+                free_[index] = *static_cast<void**>(p);
+                return p;
+            }
+            return _bump((index + 1) * _small_step, _small_step);
+        }
+        return _bump(bytes, alignment);
+    }
+
+    inline void Arena::deallocate(void* p, size_t bytes, size_t alignment) noexcept {
+        if ( !p )
+            return;
+        if ( bytes <= _small_max && alignment <= _small_step ) {
+            size_t index = bytes ? (bytes - 1) / _small_step : 0;
+            *static_cast<void**>(p) = free_[index];
+            free_[index] = p;
+        }
+        else if ( static_cast<char*>(p) + bytes == cursor_ ) {
+            // The latest allocation, so it can be bumped over again
+            cursor_ = static_cast<char*>(p);
+            used_ -= bytes;
+        }
+    }
+
+    inline void Arena::reset() noexcept {
+        while ( blocks_ ) {
+            _ArenaBlock* block = blocks_;
+            blocks_ = block->next;
+            if ( block->size == block_size_ ) {
+                block->next = spare_;
+                spare_ = block;
+            }
+            else {
+                reserved_ -= block->size;
+                ::operator delete(block);
+            }
+        }
+        std::fill(std::begin(free_), std::end(free_), nullptr);
+        cursor_ = end_ = nullptr;
+        used_ = 0;
+    }
+
+    inline size_t Arena::used() const noexcept {
+        return used_;
+    }
+
+    inline size_t Arena::reserved() const noexcept {
+        return reserved_;
+    }
+
+    inline size_t Arena::block_size() const noexcept {
+        return block_size_;
+    }
+
+    inline ArenaResource& Arena::resource() noexcept {
+        return resource_;
+    }
+
+    inline void* Arena::_bump(size_t bytes, size_t alignment) {
+        uintptr_t aligned = (reinterpret_cast<uintptr_t>(cursor_) + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        if ( cursor_ && aligned + bytes <= reinterpret_cast<uintptr_t>(end_) ) {
+            cursor_ = reinterpret_cast<char*>(aligned + bytes);
+            used_ += bytes;
+            return reinterpret_cast<void*>(aligned);
+        }
+        return _allocate_slow(bytes, alignment);
+    }
+
+    inline void* Arena::_allocate_slow(size_t bytes, size_t alignment) {
+        size_t needed = bytes + (alignment > alignof(std::max_align_t) ? alignment : 0);
+        if ( needed < bytes )
+            throw std::bad_alloc();
+        if ( needed > block_size_ / 4 ) {
+            // Too big to share a block - given its own, behind the current one
+            _ArenaBlock* block = _new_block(needed);
+            block->next = blocks_ ? blocks_->next : nullptr;
+            (blocks_ ? blocks_->next : blocks_) = block;
+            reserved_ += block->size;
+            uintptr_t start = reinterpret_cast<uintptr_t>(block + 1);
+            used_ += bytes;
+            return reinterpret_cast<void*>((start + alignment - 1) & ~(uintptr_t(alignment) - 1));
+        }
+        _ArenaBlock* block = spare_;
+        if ( block ) {
+            spare_ = block->next;
+        }
+        else {
+            block = _new_block(block_size_);
+            reserved_ += block->size;
+        }
+        block->next = blocks_;
+        blocks_ = block;
+        cursor_ = reinterpret_cast<char*>(block + 1);
+        end_ = cursor_ + block->size;
+        return _bump(bytes, alignment);
+    }
+
+    inline _ArenaBlock* Arena::_new_block(size_t size) {
+        _ArenaBlock* block = static_cast<_ArenaBlock*>(::operator new(sizeof(_ArenaBlock) + size));
+        block->next = nullptr;
+        block->size = size;
+        return block;
+    }
+
+    inline void Arena::_free_blocks(_ArenaBlock* block) noexcept {
+        while ( block ) {
+            _ArenaBlock* next = block->next;
+            ::operator delete(block);
+            block = next;
+        }
+    }
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Thread::id
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // 0 should never be expected for a thread on most modern OSs
+    Thread::id::id() noexcept: id_(0) {}
+
+    // Failure should not be expected on most modern OSs
+    #if SIMPLY_WINDOWS
+        Thread::id::id(Thread::native_handle_type handle) noexcept: id_(GetThreadId(handle)) {}
+    
+    #elif SIMPLY_LINUX
+        Thread::id::id(Thread::native_handle_type handle) noexcept: id_(handle) {}
+    #endif
+
+    bool operator==(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ == rhs.id_; }
+
+    #if SIMPLY_std20plus
+        std::strong_ordering operator<=>(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ <=> rhs.id_; }
+
+    #else
+        bool operator!=(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ != rhs.id_; } 
+        bool operator>(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ > rhs.id_; } 
+        bool operator<(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ < rhs.id_; }
+        bool operator<=(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ <= rhs.id_; } 
+        bool operator>=(Thread::id lhs, Thread::id rhs) noexcept { return lhs.id_ >= rhs.id_; }
+    #endif
+
+    template <class CharT, class Traits>
+    inline std::basic_ostream<CharT, Traits>&
+    operator<<(std::basic_ostream<CharT, Traits>& lhs, Thread::id rhs) { lhs << std::to_string(rhs.id_); return lhs; }
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Thread
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    #if SIMPLY_std20plus
+        #define TYPE_STOP_SOURCE const std::stop_source&
+    
+    #else
+        #define TYPE_STOP_SOURCE void* 
+    #endif 
+
+    /* === Start Thread Wrappers === ++++++++++++++++++++++++++++++++ */
+    #if SIMPLY_WINDOWS
+        #define THREAD_RETURN_TYPE unsigned __stdcall
+        #define SIMPLY_NULL_THREAD nullptr
+    
+    #elif SIMPLY_LINUX  
+        #define THREAD_RETURN_TYPE void*
+        #define SIMPLY_NULL_THREAD 0
+    #endif
+    
+    // Defined with the rest of the registry, below
+    inline void _registry_rename(Thread::id id, const std::string& name) noexcept;
+    inline void _trace_rename(Thread::id id, const std::string& name) noexcept;
+
+    #if SIMPLY_WINDOWS
+        inline std::string _from_wstring(const std::wstring& wname) noexcept {
+            size_t len = std::wcstombs(nullptr, wname.c_str(), 0) + 1;
+            char* buffer = new char[len];
+            std::wcstombs(buffer, wname.c_str(), len);
+            std::string name(buffer);
+            delete[] buffer;
+            return name;
+        }
+
+        inline std::wstring _to_wstring(const std::string& name) noexcept {
+            size_t len = std::mbstowcs(nullptr, name.c_str(), 0) + 1;
+            wchar_t* buffer = new wchar_t[len];
+            std::mbstowcs(buffer, name.c_str(), len);
+            std::wstring wname(buffer);
+            delete[] buffer;
+            return wname;
+        }
+
+        inline std::wstring _get_wide_name(HANDLE handle) {
+            PWSTR description = nullptr;
+            GetThreadDescription(handle, &description); // Check error...
+            std::wstring wname(description);
+            LocalFree(description); // Check error...
+            return wname;
+        }
+
+        inline void _set_wide_name(HANDLE handle, const std::wstring& wname) {
+            SetThreadDescription(handle, wname.c_str());
+            _registry_rename(Thread::id(handle), _from_wstring(wname));
+            #if SIMPLY_TRACE
+                _trace_rename(Thread::id(handle), _from_wstring(wname));
+            #endif
+        }
+
+        inline std::string _get_name(HANDLE handle) {
+            return _from_wstring(_get_wide_name(handle));
+        }
+
+        inline void _set_name(HANDLE handle, const std::string& name) {
+            _set_wide_name(handle, _to_wstring(name));
+        }
+
+    #elif SIMPLY_LINUX
+        inline std::string _get_name(pthread_t thread) {
+            char name[16];
+            pthread_getname_np(thread, name, sizeof(name));
+            return name;
+        }
+
+        inline void _set_name(pthread_t thread, const std::string& name) {
+            if ( name.size() > 15 )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "this_thread::set_name: Linux only supports 15 chars followed by NULL for name"
+                );
+            pthread_setname_np(thread, name.c_str());
+            _registry_rename(Thread::id(thread), name);
+            #if SIMPLY_TRACE
+                _trace_rename(Thread::id(thread), name);
+            #endif
+        }
+        
+    #endif
+
+    // `name` with an `_index` suffix for one of several threads - Linux limits
+    // names to 15 chars, so this trims the prefix rather than the index
+    inline std::string _numbered_name(const std::string& name, size_t index) {
+        std::string suffix = "_" + std::to_string(index);
+        return name.substr(0, 15 - std::min<size_t>(suffix.size(), 15)) + suffix;
+    }
+
+    #if SIMPLY_WINDOWS
+        inline Thread::Priority _get_priority(HANDLE thread) {
+            int p = GetThreadPriority(thread);
+            switch ( p ) {
+                case THREAD_PRIORITY_ERROR_RETURN:
+                    throw std::system_error(
+                        GetLastError(),
+                        std::system_category()
+                    );
+                case THREAD_PRIORITY_IDLE:
+                    return Thread::Priority::IDLE;
+                case THREAD_PRIORITY_LOWEST:
+                    return Thread::Priority::LOWEST;
+                case THREAD_PRIORITY_BELOW_NORMAL:
+                    return Thread::Priority::LOW;
+                case THREAD_PRIORITY_NORMAL:
+                    return Thread::Priority::NORMAL;
+                case THREAD_PRIORITY_ABOVE_NORMAL:
+                    return Thread::Priority::HIGH;
+                case THREAD_PRIORITY_HIGHEST:
+                    return Thread::Priority::HIGHEST;
+                case THREAD_PRIORITY_TIME_CRITICAL:
+                    return Thread::Priority::TIME_CRITICAL;
+                default:
+                    if ( p < 0 )
+                        return Thread::Priority::IDLE;
+                    else
+                        return Thread::Priority::TIME_CRITICAL;
+            }
+        }
+
+        inline void _set_priority(HANDLE thread, Thread::Priority priority) {
+            if ( !SetThreadPriority(thread, priority) )
+                throw std::system_error(GetLastError(), std::system_category());
+        }
+
+        // CPU set ids of the efficiency cores - those of the lowest
+        // EfficiencyClass, or none if every core has the same
+        inline std::vector<ULONG> _read_efficiency_cpu_sets() {
+            std::vector<ULONG> ids;
+            ULONG length = 0;
+            GetSystemCpuSetInformation(nullptr, 0, &length, GetCurrentProcess(), 0);
+            std::unique_ptr<char[]> buffer(new char[length ? length : 1]);
+            if ( !GetSystemCpuSetInformation(reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.get()), length, &length, GetCurrentProcess(), 0) )
+                return ids;
+
+            BYTE lowest = 0xFF, highest = 0;
+            for ( int pass = 0; pass < 2; pass++ ) {
+                for ( ULONG at = 0; at < length; ) {
+                    auto* info = reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.get() + at);
+                    if ( info->Type == CpuSetInformation ) {
+                        BYTE efficiency = info->CpuSet.EfficiencyClass;
+                        if ( pass == 0 ) {
+                            lowest = std::min(lowest, efficiency);
+                            highest = std::max(highest, efficiency);
+                        }
+                        else if ( efficiency == lowest ) {
+                            ids.push_back(info->CpuSet.Id);
+                        }
+                    }
+                    at += info->Size;
+                }
+                if ( lowest >= highest )
+                    break;
+            }
+            return ids;
+        }
+
+        inline const std::vector<ULONG>& _efficiency_cpu_sets() {
+            static const std::vector<ULONG> ids = _read_efficiency_cpu_sets();
+            return ids;
+        }
+
+        // Returns the error rather than throw, for use on a thread not yet resumed
+        inline DWORD _set_qos(HANDLE thread, Thread::QoS qos) noexcept {
+            // No control bit leaves throttling to the OS, one without its state bit opts out
+            THREAD_POWER_THROTTLING_STATE throttling {};
+            throttling.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+            throttling.ControlMask = qos == Thread::QoS::DEFAULT ? 0 : THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+            throttling.StateMask = qos >= Thread::QoS::EFFICIENCY ? THREAD_POWER_THROTTLING_EXECUTION_SPEED : 0;
+            if ( !SetThreadInformation(thread, ThreadPowerThrottling, &throttling, sizeof(throttling)) )
+                return GetLastError();
+
+            // Selected CPU sets are a preference the scheduler keeps to, unlike affinity
+            BOOL ok;
+            try {
+                const std::vector<ULONG>& efficient = _efficiency_cpu_sets();
+                if ( qos >= Thread::QoS::EFFICIENCY && !efficient.empty() )
+                    ok = SetThreadSelectedCpuSets(thread, efficient.data(), static_cast<ULONG>(efficient.size()));
+                else
+                    ok = SetThreadSelectedCpuSets(thread, nullptr, 0);
+            }
+            catch ( const std::bad_alloc& ) {
+                return ERROR_NOT_ENOUGH_MEMORY;
+            }
+            if ( !ok )
+                return GetLastError();
+
+            int priority = GetThreadPriority(thread);
+            if ( priority == THREAD_PRIORITY_ERROR_RETURN )
+                return GetLastError();
+            if ( qos == Thread::QoS::BACKGROUND && priority != THREAD_PRIORITY_IDLE && !SetThreadPriority(thread, THREAD_PRIORITY_IDLE) )
+                return GetLastError();
+            if ( qos != Thread::QoS::BACKGROUND && priority == THREAD_PRIORITY_IDLE && !SetThreadPriority(thread, THREAD_PRIORITY_NORMAL) )
+                return GetLastError();
+            return 0;
+        }
+
+        inline Thread::QoS _get_qos(HANDLE thread) {
+            THREAD_POWER_THROTTLING_STATE throttling {};
+            throttling.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+            if ( !GetThreadInformation(thread, ThreadPowerThrottling, &throttling, sizeof(throttling)) )
+                throw std::system_error(GetLastError(), std::system_category());
+            if ( !(throttling.ControlMask & THREAD_POWER_THROTTLING_EXECUTION_SPEED) )
+                return Thread::QoS::DEFAULT;
+            if ( !(throttling.StateMask & THREAD_POWER_THROTTLING_EXECUTION_SPEED) )
+                return Thread::QoS::LATENCY;
+            return _get_priority(thread) == Thread::Priority::IDLE ? Thread::QoS::BACKGROUND : Thread::QoS::EFFICIENCY;
+        }
+
+    #elif SIMPLY_LINUX
+        inline void _check_scheduling(Thread::Policy policy, int priority, const char* called_from) {
+            if ( policy == Thread::Policy::DEADLINE )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    std::string(called_from) + ": DEADLINE takes runtime/deadline/period, not a priority!"
+                );
+            if ( priority < sched_get_priority_min(policy) || priority > sched_get_priority_max(policy) )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    std::string(called_from) + ": Priority is out of range for this policy!"
+                );
+        }
+
+        inline void _check_deadline(const Thread::Deadline& deadline, const char* called_from) {
+            auto period = deadline.period.count() ? deadline.period : deadline.deadline;
+            // The kernel rejects runtimes below 1024ns
+            if ( deadline.runtime.count() < 1024 || deadline.runtime > deadline.deadline || deadline.deadline > period )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    std::string(called_from) + ": Requires 1024ns <= runtime <= deadline <= period!"
+                );
+        }
+
+        inline void _check_nice(int nice, const char* called_from) {
+            if ( nice < -20 || nice > 19 )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    std::string(called_from) + ": Nice must be from -20 to 19!"
+                );
+        }
+
+        // Mirrors the kernel's struct sched_attr, which older libc headers lack
+        struct _SchedAttr {
+            uint32_t size;
+            uint32_t sched_policy;
+            uint64_t sched_flags;
+            int32_t  sched_nice;
+            uint32_t sched_priority;
+            uint64_t sched_runtime;
+            uint64_t sched_deadline;
+            uint64_t sched_period;
+            uint32_t sched_util_min;    // Since 5.3 - older kernels ignore these when zero
+            uint32_t sched_util_max;
+        };
+
+        // Flags of sched_attr, which older headers lack
+        constexpr uint64_t _sched_flag_reset_on_fork = 0x01;
+        constexpr uint64_t _sched_flag_keep_all = 0x08 | 0x10;      // KEEP_POLICY | KEEP_PARAMS
+        constexpr uint64_t _sched_flag_util_clamp = 0x20 | 0x40;    // UTIL_CLAMP_MIN | UTIL_CLAMP_MAX
+
+        // SCHED_ATTR_SIZE_VER0 - sched_attr without the clamps, as before 5.3
+        constexpr uint32_t _sched_attr_size_ver0 = 48;
+
+        // Utilization of a big core at full speed, SCHED_CAPACITY_SCALE
+        constexpr uint32_t _util_scale = 1024;
+
+        // These act on the calling thread, so return errno rather than throw
+        // for use before the thread function runs
+        inline int _set_deadline(const Thread::Deadline& deadline) noexcept {
+            _SchedAttr attr {};
+            attr.size = sizeof(attr);
+            attr.sched_policy = SCHED_DEADLINE;
+            attr.sched_runtime = static_cast<uint64_t>(deadline.runtime.count());
+            attr.sched_deadline = static_cast<uint64_t>(deadline.deadline.count());
+            attr.sched_period = static_cast<uint64_t>(deadline.period.count());
+            return syscall(SYS_sched_setattr, 0, &attr, 0) ? errno : 0;
+        }
+
+        inline int _set_nice(int nice) noexcept {
+            return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), nice) ? errno : 0;
+        }
+
+        // Contents of a /proc file, empty if it can't be read
+        inline std::string _read_proc(const std::string& path) {
+            std::string contents;
+            if ( FILE* file = std::fopen(path.c_str(), "r") ) {
+                char buffer[1024];
+                size_t n;
+                while ( (n = std::fread(buffer, 1, sizeof(buffer), file)) > 0 )
+                    contents.append(buffer, n);
+                std::fclose(file);
+            }
+            return contents;
+        }
+
+        // What each Thread::QoS sets - a timer slack of 0 is the thread's default, 50us unless changed
+        struct _QoSSettings {
+            uint32_t util_min;
+            uint32_t util_max;
+            unsigned long timer_slack_ns;
+        };
+
+        inline _QoSSettings _qos_settings(Thread::QoS qos) noexcept {
+            switch ( qos ) {
+                case Thread::QoS::LATENCY:
+                    return {_util_scale, _util_scale, 1};
+                case Thread::QoS::EFFICIENCY:
+                    return {0, _util_scale / 2, 1000000};
+                case Thread::QoS::BACKGROUND:
+                    return {0, _util_scale / 4, 10000000};
+                default:
+                    return {0, _util_scale, 0};
+            }
+        }
+
+        // Sets `tid`, 0 for the calling thread. The policy and the clamps go
+        // in one sched_setattr, keeping the rest of the scheduling as it is
+        inline int _set_qos(pid_t tid, Thread::QoS qos) noexcept {
+            _SchedAttr attr {};
+            if ( syscall(SYS_sched_getattr, tid, &attr, sizeof(attr), 0) )
+                return errno;
+            attr.size = sizeof(attr);
+            attr.sched_flags &= _sched_flag_reset_on_fork;
+
+            bool idle = attr.sched_policy == SCHED_IDLE;
+            if ( qos == Thread::QoS::BACKGROUND && !idle ) {
+                attr.sched_policy = SCHED_IDLE;
+                attr.sched_priority = 0;
+                attr.sched_runtime = attr.sched_deadline = attr.sched_period = 0;
+            }
+            else if ( qos != Thread::QoS::BACKGROUND && idle ) {
+                attr.sched_policy = SCHED_OTHER;
+            }
+            else {
+                attr.sched_flags |= _sched_flag_keep_all;
+            }
+
+            _QoSSettings settings = _qos_settings(qos);
+            attr.sched_flags |= _sched_flag_util_clamp;
+            attr.sched_util_min = settings.util_min;
+            attr.sched_util_max = settings.util_max;
+            if ( syscall(SYS_sched_setattr, tid, &attr, 0) ) {
+                // Kernels before 5.3 reject the flags, and those built without uclamp the clamps
+                int err = errno;
+                if ( err != EINVAL && err != E2BIG && err != EOPNOTSUPP )
+                    return err;
+                // The clamps are zeroed and left out of the size, as older kernels
+                // reject a larger struct with anything set past what they know
+                attr.sched_flags &= ~_sched_flag_util_clamp;
+                attr.sched_util_min = attr.sched_util_max = 0;
+                attr.size = _sched_attr_size_ver0;
+                if ( !(attr.sched_flags & _sched_flag_keep_all) && syscall(SYS_sched_setattr, tid, &attr, 0) )
+                    return errno;
+            }
+
+            if ( tid == 0 ) {
+                if ( prctl(PR_SET_TIMERSLACK, settings.timer_slack_ns, 0, 0, 0) )
+                    return errno;
+            }
+            else if ( FILE* file = std::fopen(("/proc/" + std::to_string(tid) + "/timerslack_ns").c_str(), "w") ) {
+                // Only under /proc/<tid>, not /proc/self/task - and it needs
+                // CAP_SYS_NICE, without which the slack is left as it is
+                std::fprintf(file, "%lu", settings.timer_slack_ns);
+                std::fclose(file);
+            }
+            return 0;
+        }
+
+        inline Thread::QoS _get_qos(pid_t tid) {
+            _SchedAttr attr {};
+            if ( syscall(SYS_sched_getattr, tid, &attr, sizeof(attr), 0) )
+                throw std::system_error(errno, std::system_category());
+            if ( attr.sched_policy == SCHED_IDLE )
+                return Thread::QoS::BACKGROUND;
+            if ( attr.sched_util_max != 0 ) {
+                if ( attr.sched_util_max < _util_scale )
+                    return Thread::QoS::EFFICIENCY;
+                return attr.sched_util_min >= _util_scale ? Thread::QoS::LATENCY : Thread::QoS::DEFAULT;
+            }
+
+            // Kernels without uclamp leave both clamps 0, so go by the timer slack
+            unsigned long slack;
+            if ( tid == 0 ) {
+                slack = static_cast<unsigned long>(prctl(PR_GET_TIMERSLACK, 0, 0, 0, 0));
+            }
+            else {
+                std::string contents = _read_proc("/proc/" + std::to_string(tid) + "/timerslack_ns");
+                slack = contents.empty() ? 0 : std::strtoul(contents.c_str(), nullptr, 10);
+            }
+            if ( slack == _qos_settings(Thread::QoS::LATENCY).timer_slack_ns )
+                return Thread::QoS::LATENCY;
+            if ( slack >= _qos_settings(Thread::QoS::EFFICIENCY).timer_slack_ns )
+                return Thread::QoS::EFFICIENCY;
+            return Thread::QoS::DEFAULT;
+        }
+
+        inline void _set_scheduling(pthread_t thread, Thread::Policy policy, int priority) {
+            struct sched_param param {};
+            param.sched_priority = priority;
+            if ( int err = pthread_setschedparam(thread, policy, &param) )
+                throw std::system_error(err, std::system_category());
+        }
+
+        inline Thread::Policy _get_policy(pthread_t thread, int* priority = nullptr) {
+            int policy;
+            struct sched_param param {};
+            if ( int err = pthread_getschedparam(thread, &policy, &param) )
+                throw std::system_error(err, std::system_category());
+            if ( priority )
+                *priority = param.sched_priority;
+            // SCHED_RESET_ON_FORK is reported alongside the policy
+            return static_cast<Thread::Policy>(policy & ~SCHED_RESET_ON_FORK);
+        }
+
+    #endif
+
+    /* === Thread Registry === ++++++++++++++++++++++++++++++++++++++ */
+    ///   _RegistryAttributes {internal}
+    /// @brief Plain copy of the Attributes kept in a _RegistrySlot
+    ///
+    /// Read out with the rest of the slot, which allocates nothing, and
+    /// only made back into Thread::Attributes by snapshot
+    struct _RegistryAttributes {
+        static constexpr size_t affinity_words = CpuSet::max_cpus / 64;
+
+        enum Has: uint32_t {
+            AFFINITY = 1,
+            QOS      = 2,
+            PRIORITY = 4,   // Windows
+            POLICY   = 8,   // Linux, with priority
+            DEADLINE = 16,  // Linux
+            NICE     = 32   // Linux
+        };
+
+        uint32_t has;
+        uint64_t stack_size;
+        uint64_t guard_size;
+        uint64_t arena;
+        uint64_t prefault_stack;
+        uint64_t affinity[affinity_words];
+        int32_t qos;
+        int32_t priority;
+        int32_t policy;
+        int32_t nice;
+        int64_t runtime;
+        int64_t deadline;
+        int64_t period;
+        char name[64];
+    };
+
+    ///   _RegistrySlot {internal}
+    /// @brief One thread's entry - slots are never freed, only reused
+    ///
+    /// Written under a seqlock, whose writers take turns through `seq`,
+    /// so readers never block. Everything is atomic so that a reader
+    /// racing a writer is merely retried, rather than undefined.
+    struct _RegistrySlot {
+        static constexpr size_t name_words = 8;  // Up to 63 chars and the NUL
+
+        std::atomic<uint32_t> claimed{0};           // Owned by a thread, outside the seqlock
+        std::atomic<uint32_t> seq{0};               // Odd while being written
+        std::atomic<uint32_t> live{0};
+        std::atomic<Thread::id> id{Thread::id()};
+        std::atomic<uint64_t> os_id{0};
+        std::atomic<int64_t> started{0};            // system_clock nanoseconds since epoch
+        std::atomic<uint64_t> name[name_words] {};
+        _RegistrySlot* next = nullptr;              // Fixed before the slot is published
+
+        // The Attributes the thread was started with, as _RegistryAttributes
+        std::atomic<uint32_t> has{0};
+        std::atomic<uint64_t> stack_size{0};
+        std::atomic<uint64_t> guard_size{0};
+        std::atomic<uint64_t> arena{0};
+        std::atomic<uint64_t> prefault_stack{0};
+        std::atomic<uint64_t> affinity[_RegistryAttributes::affinity_words] {};
+        std::atomic<int32_t> qos{0};
+        std::atomic<int32_t> priority{0};
+        #if SIMPLY_LINUX
+            std::atomic<int32_t> policy{0};
+            std::atomic<int32_t> nice{0};
+            std::atomic<int64_t> runtime{0};
+            std::atomic<int64_t> deadline{0};
+            std::atomic<int64_t> period{0};
+        #endif
+        std::atomic<uint64_t> start_name[name_words] {};
+
+        void lock() noexcept {
+            uint32_t current = seq.load(std::memory_order_relaxed);
+            while ( (current & 1) || !seq.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed) ) {
+                _cpu_pause();
+                current = seq.load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        void unlock() noexcept {
+            seq.fetch_add(1, std::memory_order_release);
+        }
+
+        static void store_name(std::atomic<uint64_t> (&words)[name_words], const std::string& value) noexcept {
+            char buffer[name_words * 8] {};
+            std::memcpy(buffer, value.data(), std::min(value.size(), sizeof(buffer) - 1));
+            for ( size_t w = 0; w < name_words; w++ ) {
+                uint64_t word;
+                std::memcpy(&word, buffer + w * 8, 8);
+                words[w].store(word, std::memory_order_relaxed);
+            }
+        }
+
+        static void load_name(const std::atomic<uint64_t> (&words)[name_words], char (&out)[name_words * 8]) noexcept {
+            for ( size_t w = 0; w < name_words; w++ ) {
+                uint64_t word = words[w].load(std::memory_order_relaxed);
+                std::memcpy(out + w * 8, &word, 8);
+            }
+        }
+
+        void set_name(const std::string& value) noexcept {
+            store_name(name, value);
+        }
+
+        // `attributes` is null for threads started without any
+        void set_attributes(const Thread::Attributes* attributes) noexcept {
+            using Has = _RegistryAttributes::Has;
+            uint32_t has_bits = 0;
+            uint64_t cpu_words[_RegistryAttributes::affinity_words] {};
+            if ( !attributes ) {
+                has.store(0, std::memory_order_relaxed);
+                stack_size.store(0, std::memory_order_relaxed);
+                guard_size.store(0, std::memory_order_relaxed);
+                arena.store(0, std::memory_order_relaxed);
+                prefault_stack.store(0, std::memory_order_relaxed);
+                store_name(start_name, std::string());
+                return;
+            }
+            stack_size.store(attributes->stack_size(), std::memory_order_relaxed);
+            guard_size.store(attributes->guard_size(), std::memory_order_relaxed);
+            arena.store(attributes->arena(), std::memory_order_relaxed);
+            prefault_stack.store(attributes->prefault_stack(), std::memory_order_relaxed);
+            if ( const auto& cpus = attributes->affinity() ) {
+                has_bits |= Has::AFFINITY;
+                for ( size_t cpu = cpus->first(); cpu < CpuSet::max_cpus; cpu++ )
+                    if ( cpus->test(cpu) )
+                        cpu_words[cpu / 64] |= uint64_t(1) << (cpu % 64);
+            }
+            for ( size_t w = 0; w < _RegistryAttributes::affinity_words; w++ )
+                affinity[w].store(cpu_words[w], std::memory_order_relaxed);
+            if ( attributes->qos() ) {
+                has_bits |= Has::QOS;
+                qos.store(*attributes->qos(), std::memory_order_relaxed);
+            }
+            #if SIMPLY_WINDOWS
+                if ( attributes->priority() ) {
+                    has_bits |= Has::PRIORITY;
+                    priority.store(*attributes->priority(), std::memory_order_relaxed);
+                }
+            #elif SIMPLY_LINUX
+                if ( attributes->policy() ) {
+                    has_bits |= Has::POLICY;
+                    policy.store(*attributes->policy(), std::memory_order_relaxed);
+                    priority.store(attributes->priority(), std::memory_order_relaxed);
+                }
+                if ( const auto& parameters = attributes->deadline() ) {
+                    has_bits |= Has::DEADLINE;
+                    runtime.store(parameters->runtime.count(), std::memory_order_relaxed);
+                    deadline.store(parameters->deadline.count(), std::memory_order_relaxed);
+                    period.store(parameters->period.count(), std::memory_order_relaxed);
+                }
+                if ( attributes->nice() ) {
+                    has_bits |= Has::NICE;
+                    nice.store(*attributes->nice(), std::memory_order_relaxed);
+                }
+            #endif
+            store_name(start_name, attributes->name());
+            has.store(has_bits, std::memory_order_relaxed);
+        }
+
+        void get_attributes(_RegistryAttributes& out) const noexcept {
+            out.has = has.load(std::memory_order_relaxed);
+            out.stack_size = stack_size.load(std::memory_order_relaxed);
+            out.guard_size = guard_size.load(std::memory_order_relaxed);
+            out.arena = arena.load(std::memory_order_relaxed);
+            out.prefault_stack = prefault_stack.load(std::memory_order_relaxed);
+            for ( size_t w = 0; w < _RegistryAttributes::affinity_words; w++ )
+                out.affinity[w] = affinity[w].load(std::memory_order_relaxed);
+            out.qos = qos.load(std::memory_order_relaxed);
+            out.priority = priority.load(std::memory_order_relaxed);
+            #if SIMPLY_LINUX
+                out.policy = policy.load(std::memory_order_relaxed);
+                out.nice = nice.load(std::memory_order_relaxed);
+                out.runtime = runtime.load(std::memory_order_relaxed);
+                out.deadline = deadline.load(std::memory_order_relaxed);
+                out.period = period.load(std::memory_order_relaxed);
+            #endif
+            load_name(start_name, out.name);
+        }
+
+        enum Read {
+            FREE,
+            LIVE,
+            BUSY    // Still being written after all `tries`
+        };
+
+        // Retries dump makes - its signal may have interrupted this slot's
+        // writer, which can't finish until the handler returns
+        static constexpr size_t signal_tries = 1024;
+
+        // Consistent copy of the slot, as long as that takes at most `tries` attempts
+        Read read(ThreadInfo* info, char (&name_out)[name_words * 8], size_t tries = std::numeric_limits<size_t>::max(),
+                  _RegistryAttributes* attributes_out = nullptr) const noexcept {
+            for ( ; tries; tries-- ) {
+                uint32_t before = seq.load(std::memory_order_acquire);
+                if ( before & 1 ) {
+                    _cpu_pause();
+                    continue;
+                }
+                bool is_live = live.load(std::memory_order_relaxed);
+                Thread::id read_id = id.load(std::memory_order_relaxed);
+                uint64_t read_os_id = os_id.load(std::memory_order_relaxed);
+                int64_t read_started = started.load(std::memory_order_relaxed);
+                load_name(name, name_out);
+                if ( attributes_out )
+                    get_attributes(*attributes_out);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if ( seq.load(std::memory_order_relaxed) != before )
+                    continue;
+                if ( is_live && info ) {
+                    info->id = read_id;
+                    info->os_id = read_os_id;
+                    info->started = std::chrono::system_clock::time_point(
+                        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(read_started))
+                    );
+                }
+                name_out[sizeof(name_out) - 1] = 0;
+                if ( attributes_out )
+                    attributes_out->name[sizeof(attributes_out->name) - 1] = 0;
+                return is_live ? LIVE : FREE;
+            }
+            return BUSY;
+        }
+    };
+
+    inline std::atomic<bool>& _registry_enabled() noexcept {
+        static std::atomic<bool> enabled{false};
+        return enabled;
+    }
+
+    inline std::atomic<_RegistrySlot*>& _registry_head() noexcept {
+        static std::atomic<_RegistrySlot*> head{nullptr};
+        return head;
+    }
+
+    inline _RegistrySlot*& _registry_self() noexcept {
+        thread_local _RegistrySlot* slot = nullptr;
+        return slot;
+    }
+
+    // Runs on the new thread, once it has been named, with the Attributes
+    // it was started with if any
+    inline void _registry_enter(const Thread::Attributes* attributes) noexcept {
+        _RegistrySlot* slot = _registry_head().load(std::memory_order_acquire);
+        for ( ; slot; slot = slot->next ) {
+            uint32_t free = 0;
+            if ( slot->claimed.compare_exchange_strong(free, 1, std::memory_order_acquire) )
+                break;
+        }
+        if ( !slot ) {
+            slot = new (std::nothrow) _RegistrySlot;
+            if ( !slot )
+                return;
+            slot->claimed.store(1, std::memory_order_relaxed);
+            slot->next = _registry_head().load(std::memory_order_relaxed);
+            while ( !_registry_head().compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed) )
+                ;
+        }
+
+        std::string name;
+        try {
+            #if SIMPLY_WINDOWS
+                name = _get_name(GetCurrentThread());
+            #elif SIMPLY_LINUX
+                name = _get_name(pthread_self());
+            #endif
+        }
+        catch ( ... ) {}
+        auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch());
+
+        slot->lock();
+        // Not this_thread::get_id, whose cache may already be gone on an exiting thread
+        #if SIMPLY_WINDOWS
+            slot->id.store(Thread::id(GetCurrentThread()), std::memory_order_relaxed);
+        #elif SIMPLY_LINUX
+            slot->id.store(Thread::id(pthread_self()), std::memory_order_relaxed);
+        #endif
+        #if SIMPLY_WINDOWS
+            slot->os_id.store(GetCurrentThreadId(), std::memory_order_relaxed);
+        #elif SIMPLY_LINUX
+            slot->os_id.store(static_cast<uint64_t>(syscall(SYS_gettid)), std::memory_order_relaxed);
+        #endif
+        slot->started.store(now.count(), std::memory_order_relaxed);
+        slot->set_name(name);
+        slot->set_attributes(attributes);
+        slot->live.store(1, std::memory_order_relaxed);
+        slot->unlock();
+        _registry_self() = slot;
+    }
+
+    inline void _registry_leave() noexcept {
+        _RegistrySlot* slot = _registry_self();
+        slot->lock();
+        slot->live.store(0, std::memory_order_relaxed);
+        slot->unlock();
+        slot->claimed.store(0, std::memory_order_release);
+        _registry_self() = nullptr;
+    }
+
+    inline void _registry_rename(Thread::id id, const std::string& name) noexcept {
+        _RegistrySlot* slot = _registry_self();
+        if ( !slot || slot->id.load(std::memory_order_relaxed) != id ) {
+            // Another thread, which may be registered even if no longer enabled
+            for ( slot = _registry_head().load(std::memory_order_acquire); slot; slot = slot->next )
+                if ( slot->claimed.load(std::memory_order_acquire) && slot->id.load(std::memory_order_relaxed) == id )
+                    break;
+            if ( !slot )
+                return;
+        }
+        slot->lock();
+        if ( slot->live.load(std::memory_order_relaxed) && slot->id.load(std::memory_order_relaxed) == id )
+            slot->set_name(name);
+        slot->unlock();
+    }
+
+    /* === Thread Indices === +++++++++++++++++++++++++++++++++++++++ */
+    // Small dense numbers for live threads, taken on first use - PerThread
+    // keeps a slot per index. The lowest free index is handed out first,
+    // so the numbers stay within the peak count of threads using them.
+    struct _ThreadIndices {
+        std::mutex mutex;
+        std::vector<uint32_t> free;     // Min-heap
+        uint32_t next = 0;
+    };
+
+    constexpr uint32_t _no_thread_index = std::numeric_limits<uint32_t>::max();
+
+    // Never destroyed, as threads may still give their index back during exit
+    inline _ThreadIndices& _thread_indices() noexcept {
+        static _ThreadIndices* indices = new _ThreadIndices;
+        return *indices;
+    }
+
+    inline uint32_t& _thread_index_self() noexcept {
+        thread_local uint32_t index = _no_thread_index;
+        return index;
+    }
+
+    inline void _thread_index_release() noexcept {
+        uint32_t& index = _thread_index_self();
+        if ( index == _no_thread_index )
+            return;
+        _ThreadIndices& indices = _thread_indices();
+        std::lock_guard<std::mutex> lock(indices.mutex);
+        indices.free.push_back(index);
+        std::push_heap(indices.free.begin(), indices.free.end(), std::greater<uint32_t>());
+        index = _no_thread_index;
+    }
+
+    // Gives it back as the thread exits - simply::Threads already have as their function returns
+    struct _ThreadIndexExit {
+        ~_ThreadIndexExit() { _thread_index_release(); }
+    };
+
+    inline uint32_t _thread_index_acquire() {
+        uint32_t index;
+        {
+            _ThreadIndices& indices = _thread_indices();
+            std::lock_guard<std::mutex> lock(indices.mutex);
+            if ( !indices.free.empty() ) {
+                std::pop_heap(indices.free.begin(), indices.free.end(), std::greater<uint32_t>());
+                index = indices.free.back();
+                indices.free.pop_back();
+            }
+            else {
+                index = indices.next++;
+            }
+        }
+        static thread_local _ThreadIndexExit on_exit;
+        (void)on_exit;
+        return _thread_index_self() = index;
+    }
+
+    ///   _thread_index {internal}
+    /// @brief This thread's index, taking one if it has none
+    inline uint32_t _thread_index() {
+        uint32_t index = _thread_index_self();
+        return index != _no_thread_index ? index : _thread_index_acquire();
+    }
+
+    /* === Trace Buffers === ++++++++++++++++++++++++++++++++++++++++ */
+    inline std::atomic<_TraceBuffer*>& _trace_head() noexcept {
+        static std::atomic<_TraceBuffer*> head{nullptr};
+        return head;
+    }
+
+    // A TSC reading and steady_clock at the same moment, to convert the other readings
+    struct _TraceEpoch {
+        uint64_t ticks;
+        int64_t ns;
+    };
+
+    inline _TraceEpoch _trace_now() noexcept {
+        return _TraceEpoch{_trace_clock(), std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count()};
+    }
+
+    inline const _TraceEpoch& _trace_epoch() noexcept {
+        static const _TraceEpoch epoch = _trace_now();
+        return epoch;
+    }
+
+    // The owner's buffer is kept for Trace::write, and reused by a later thread
+    inline void _trace_release() noexcept {
+        _TraceBuffer*& buffer = _trace_self();
+        if ( !buffer )
+            return;
+        buffer->claimed.store(0, std::memory_order_release);
+        buffer = nullptr;
+    }
+
+    struct _TraceExit {
+        ~_TraceExit() { _trace_release(); }
+    };
+
+    inline _TraceBuffer* _trace_acquire() noexcept {
+        _trace_epoch();
+        _TraceBuffer* buffer = _trace_head().load(std::memory_order_acquire);
+        for ( ; buffer; buffer = buffer->next ) {
+            uint32_t free = 0;
+            if ( buffer->claimed.compare_exchange_strong(free, 1, std::memory_order_acquire) )
+                break;
+        }
+        if ( !buffer ) {
+            buffer = new (std::nothrow) _TraceBuffer;
+            if ( !buffer )
+                return nullptr;
+            buffer->claimed.store(1, std::memory_order_relaxed);
+            buffer->next = _trace_head().load(std::memory_order_relaxed);
+            while ( !_trace_head().compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed) )
+                ;
+        }
+
+        std::string name;
+        try {
+            #if SIMPLY_WINDOWS
+                name = _get_name(GetCurrentThread());
+            #elif SIMPLY_LINUX
+                name = _get_name(pthread_self());
+            #endif
+        }
+        catch ( ... ) {}
+
+        // A reused buffer drops the last thread's events
+        buffer->floor.store(buffer->head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        #if SIMPLY_WINDOWS
+            buffer->id.store(Thread::id(GetCurrentThread()), std::memory_order_relaxed);
+            buffer->os_id.store(GetCurrentThreadId(), std::memory_order_relaxed);
+        #elif SIMPLY_LINUX
+            buffer->id.store(Thread::id(pthread_self()), std::memory_order_relaxed);
+            buffer->os_id.store(static_cast<uint64_t>(syscall(SYS_gettid)), std::memory_order_relaxed);
+        #endif
+        {
+            std::lock_guard<std::mutex> lock(buffer->name_mutex);
+            buffer->name.swap(name);
+        }
+
+        // simply::Threads give it back as their function returns, others as they exit
+        static thread_local _TraceExit on_exit;
+        (void)on_exit;
+        return _trace_self() = buffer;
+    }
+
+    inline void _trace_rename(Thread::id id, const std::string& name) noexcept {
+        for ( _TraceBuffer* buffer = _trace_head().load(std::memory_order_acquire); buffer; buffer = buffer->next ) {
+            if ( buffer->claimed.load(std::memory_order_acquire) && buffer->id.load(std::memory_order_relaxed) == id ) {
+                std::lock_guard<std::mutex> lock(buffer->name_mutex);
+                try {
+                    buffer->name = name;
+                }
+                catch ( ... ) {}
+                return;
+            }
+        }
+    }
+
+    ///   _RegistryEntry {internal}
+    /// @brief Registers the new thread for as long as its function runs
+    ///
+    /// `attributes` need only last for the constructor, as they are copied
+    struct _RegistryEntry {
+        explicit _RegistryEntry(const Thread::Attributes* attributes = nullptr) noexcept {
+            if ( _registry_enabled().load(std::memory_order_relaxed) )
+                _registry_enter(attributes);
+            #if SIMPLY_TRACE
+                _trace_event('B', "thread");
+            #endif
+        }
+
+        ~_RegistryEntry() {
+            #if SIMPLY_TRACE
+                _trace_event('E', "thread");
+                _trace_release();
+            #endif
+            if ( _registry_self() )
+                _registry_leave();
+            _thread_index_release();
+        }
+
+        _RegistryEntry(const _RegistryEntry&) = delete;
+        _RegistryEntry& operator=(const _RegistryEntry&) = delete;
+    };
+
+    inline Arena*& _arena_self() noexcept {
+        thread_local Arena* arena = nullptr;
+        return arena;
+    }
+
+    ///   _ArenaEntry {internal}
+    /// @brief Gives the new thread its Arena for as long as its function runs
+    struct _ArenaEntry {
+        explicit _ArenaEntry(size_t block_size) noexcept {
+            if ( block_size ) {
+                arena.emplace(block_size);
+                _arena_self() = &*arena;
+            }
+        }
+
+        ~_ArenaEntry() {
+            if ( arena )
+                _arena_self() = nullptr;
+        }
+
+        _ArenaEntry(const _ArenaEntry&) = delete;
+        _ArenaEntry& operator=(const _ArenaEntry&) = delete;
+
+        std::optional<Arena> arena;
+    };
+
+    /* === Thread Control === +++++++++++++++++++++++++++++++++++++++ */
+    ///   _ThreadControl {internal}
+    /// @brief The calling thread's id, name, affinity, priority, QoS and stop token, as this_thread returns them
+    ///
+    /// Each is asked of the OS once, then kept. this_thread's setters update
+    /// the cache as they go, while changing another thread through its
+    /// simply::Thread bumps `_control_epoch`, so every thread asks again on
+    /// its next read. Changes made around simply-threading, such as by
+    /// taskset or a direct pthread_setname_np, aren't seen.
+    struct _ThreadControl {
+        uint64_t epoch = 0;                 // The _control_epoch the cache is from
+        Thread::id id;
+        std::optional<std::string> name;
+        std::optional<CpuSet> affinity;
+
+        #if SIMPLY_WINDOWS
+            std::optional<Thread::Priority> priority;
+        #elif SIMPLY_LINUX
+            std::optional<std::pair<Thread::Policy, int>> scheduling;
+        #endif
+
+        std::optional<Thread::QoS> qos;
+
+        #if SIMPLY_std20plus
+            std::stop_token stop_token;     // Of the simply::Thread running its function
+        #endif
+
+        // Drops what may have been changed from another thread since cached
+        void refresh() noexcept;
+
+        // Drops everything but the id
+        void forget() noexcept;
+    };
+
+    inline std::atomic<uint64_t>& _control_epoch() noexcept {
+        static std::atomic<uint64_t> epoch{0};
+        return epoch;
+    }
+
+    inline _ThreadControl& _control_self() noexcept {
+        thread_local _ThreadControl control;
+        return control;
+    }
+
+    inline void _ThreadControl::refresh() noexcept {
+        uint64_t current = _control_epoch().load(std::memory_order_acquire);
+        if ( epoch == current )
+            return;
+        epoch = current;
+        forget();
+    }
+
+    inline void _ThreadControl::forget() noexcept {
+        name.reset();
+        affinity.reset();
+        #if SIMPLY_WINDOWS
+            priority.reset();
+        #elif SIMPLY_LINUX
+            scheduling.reset();
+        #endif
+        qos.reset();
+    }
+
+    // After a simply::Thread changed its thread - which may be any, including this one
+    inline void _control_changed() noexcept {
+        _control_epoch().fetch_add(1, std::memory_order_release);
+    }
+
+    #if SIMPLY_std20plus
+        ///   _ControlEntry {internal}
+        /// @brief Gives the new thread its stop token for as long as its function runs
+        struct _ControlEntry {
+            explicit _ControlEntry(const std::stop_token& token) noexcept {
+                _control_self().stop_token = token;
+            }
+
+            ~_ControlEntry() {
+                _control_self().stop_token = std::stop_token();
+            }
+
+            _ControlEntry(const _ControlEntry&) = delete;
+            _ControlEntry& operator=(const _ControlEntry&) = delete;
+        };
+    #endif
+
+    inline size_t _page_size() noexcept {
+        #if SIMPLY_WINDOWS
+            static const size_t page = []{
+                SYSTEM_INFO info;
+                GetSystemInfo(&info);
+                return static_cast<size_t>(info.dwPageSize);
+            }();
+        #elif SIMPLY_LINUX
+            static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        #endif
+        return page;
+    }
+
+    // Stack kept free below a prefault, for guard pages and the calls made while locking
+    constexpr size_t _prefault_margin = 64 * 1024;
+
+    // Bytes of stack below the caller's frame, 0 if unknown
+    inline size_t _stack_room() noexcept {
+        char here;
+        uintptr_t top = reinterpret_cast<uintptr_t>(&here);
+        #if SIMPLY_WINDOWS
+            // The stack is one reservation, with its guard pages at the bottom
+            MEMORY_BASIC_INFORMATION info;
+            if ( !VirtualQuery(&here, &info, sizeof(info)) )
+                return 0;
+            return top - reinterpret_cast<uintptr_t>(info.AllocationBase);
+        #elif SIMPLY_LINUX
+            pthread_attr_t attr;
+            if ( pthread_getattr_np(pthread_self(), &attr) )
+                return 0;
+            void* low = nullptr;
+            size_t size = 0, guard = 0;
+            int err = pthread_attr_getstack(&attr, &low, &size);
+            pthread_attr_getguardsize(&attr, &guard);
+            pthread_attr_destroy(&attr);
+            // Whether the guard is within the reported stack differs by libc, so assume it is
+            uintptr_t bottom = reinterpret_cast<uintptr_t>(low) + guard;
+            return err || top <= bottom ? 0 : top - bottom;
+        #endif
+    }
+
+    ///   _StackPrefault {internal}
+    /// @brief Makes the top of the new thread's stack resident and locked, until its function returns
+    ///
+    /// Unlocked explicitly, since the stack may be cached and handed to the next thread
+    struct _StackPrefault {
+        _StackPrefault() = default;
+
+        _StackPrefault(const _StackPrefault&) = delete;
+        _StackPrefault& operator=(const _StackPrefault&) = delete;
+
+        // Never inlined - its alloca must be popped again, leaving the touched pages for the thread function
+        SIMPLY_NOINLINE int lock(size_t bytes) noexcept {
+            if ( bytes + _prefault_margin > _stack_room() )
+                #if SIMPLY_WINDOWS
+                    return ERROR_INVALID_PARAMETER;
+                #elif SIMPLY_LINUX
+                    return EINVAL;
+                #endif
+
+            // Top down, as Windows commits its stack one guard page at a time
+            size_t page = _page_size();
+            #if SIMPLY_WINDOWS
+                volatile char* low = static_cast<volatile char*>(_alloca(bytes));
+            #elif SIMPLY_LINUX
+                volatile char* low = static_cast<volatile char*>(alloca(bytes));
+            #endif
+            for ( size_t at = bytes; at > page; at -= page )
+                low[at - 1] = 0;
+            low[0] = 0;
+
+            uintptr_t begin = reinterpret_cast<uintptr_t>(low) & ~(page - 1);
+            size_t size = reinterpret_cast<uintptr_t>(low) + bytes - begin;
+            #if SIMPLY_WINDOWS
+                if ( !VirtualLock(reinterpret_cast<void*>(begin), size) )
+                    return static_cast<int>(GetLastError());
+            #elif SIMPLY_LINUX
+                if ( mlock(reinterpret_cast<void*>(begin), size) )
+                    return errno;
+            #endif
+            addr_ = reinterpret_cast<void*>(begin);
+            size_ = size;
+            return 0;
+        }
+
+        ~_StackPrefault() {
+            if ( size_ )
+                #if SIMPLY_WINDOWS
+                    VirtualUnlock(addr_, size_);
+                #elif SIMPLY_LINUX
+                    munlock(addr_, size_);
+                #endif
+        }
+
+    private:
+        void* addr_ = nullptr;
+        size_t size_ = 0;
+    };
+
+    // Stack requested for a new thread
+    struct _StackSpec {
+        size_t size = 0;        // 0 - system default
+        size_t guard_size = 0;  // 0 - system default
+        void* addr = nullptr;   // Lowest usable address of a caller-provided stack (Linux)
+    };
+
+    // Payloads up to this size skip the heap, see _start
+    constexpr size_t _inline_start_size = 64;
+
+    #if SIMPLY_std20plus
+        // The stop token goes last whether or not `f` takes it, for this_thread::get_stop_token
+        template <class F, class... Args>
+        using _payload_type = std::tuple<std::decay_t<F>, std::decay_t<Args>..., std::stop_token>;
+
+        // `f`, then the stop token, then `args`
+        template <size_t... I>
+        constexpr auto _token_second(std::index_sequence<I...>) noexcept {
+            return std::index_sequence<0, sizeof...(I) + 1, (I + 1)...>();
+        }
+
+        // Payload elements `f` is invoked with
+        template <class F, class... Args>
+        constexpr auto _payload_indices() noexcept {
+            if constexpr ( std::is_invocable_v<F, std::stop_token, Args...> )
+                return _token_second(std::make_index_sequence<sizeof...(Args)>());
+            else
+                return std::make_index_sequence<sizeof...(Args) + 1>();
+        }
+
+    #else
+        template <class F, class... Args>
+        using _payload_type = std::tuple<std::decay_t<F>, std::decay_t<Args>...>;
+
+        template <class F, class... Args>
+        constexpr auto _payload_indices() noexcept {
+            return std::make_index_sequence<sizeof...(Args) + 1>();
+        }
+    #endif
+
+    template <class T>
+    constexpr bool _starts_inline = sizeof(T) <= _inline_start_size && std::is_nothrow_move_constructible_v<T>;
+
+    // Returned as a prvalue, so it is constructed directly in its final storage
+    template <class T, class F, class... Args>
+    T _make_payload([[maybe_unused]] TYPE_STOP_SOURCE stop_source, F&& f, Args&&... args) {
+        #if SIMPLY_std20plus
+            static_assert(std::is_invocable_v<F, std::stop_token, Args...> || std::is_invocable_v<F, Args...>, "Thread function/args are malformed...");
+            return T(std::forward<F>(f), std::forward<Args>(args)..., stop_source.get_token());
+        #else
+            static_assert(std::is_invocable_v<F, Args...>, "Thread function/args are malformed...");
+            return T(std::forward<F>(f), std::forward<Args>(args)...);
+        #endif
+    }
+
+    ///   _StartGate {internal}
+    /// @brief Kept on the spawning thread's stack, which waits on it until the new thread has started
+    ///
+    /// Lets the new thread read the Attributes, and move an inline payload
+    /// out, before the spawning thread returns
+    struct _StartGate {
+        const Thread::Attributes* attributes;
+        void* payload;
+        std::atomic<uint32_t> started{0};
+        int error = 0;  // Set if the new thread could not apply the attributes, and won't run
+        uint64_t os_id = 0;
+
+        // New thread - this must not be touched afterwards
+        void notify() noexcept {
+            started.store(1, std::memory_order_release);
+            _futex_wake_one(started);
+        }
+
+        // Spawning thread
+        void wait() noexcept {
+            while ( !started.load(std::memory_order_acquire) )
+                _futex_wait(started, 0);
+        }
+    };
+
+    template <class T>
+    struct _InlinePayload {
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    #if SIMPLY_LINUX
+        // pthread_attr_setschedpolicy only takes OTHER, FIFO and RR - the
+        // rest are set by the new thread itself, which needs no privilege
+        inline bool _policy_in_attr(Thread::Policy policy) noexcept {
+            return policy == Thread::Policy::OTHER || policy == Thread::Policy::FIFO || policy == Thread::Policy::RR;
+        }
+    #endif
+
+    // Whether the spawning thread has to wait on the new one - for Windows
+    // only if it has any attributes to apply itself, while for Linux always,
+    // as that is how its tid gets back to the Thread
+    inline bool _needs_gate([[maybe_unused]] const Thread::Attributes& attributes) noexcept {
+        #if SIMPLY_LINUX
+            return true;
+        #else
+            // While registering, so the registry can copy the attributes
+            return attributes.arena() || attributes.prefault_stack() || _registry_enabled().load(std::memory_order_relaxed);
+        #endif
+    }
+
+    // Runs on the new thread before the thread function, returning an
+    // error code if it must not run
+    inline int _prepare_thread(const Thread::Attributes& attributes) noexcept {
+        #if SIMPLY_LINUX
+            if ( !attributes.name().empty() )
+                pthread_setname_np(pthread_self(), attributes.name().c_str());
+            // First, so an explicit policy or nice wins over what it sets -
+            // BACKGROUND may have replaced a policy pthread_create applied, so
+            // that is set again too
+            if ( attributes.qos() )
+                if ( int err = _set_qos(0, *attributes.qos()) )
+                    return err;
+            if ( attributes.policy() == Thread::Policy::DEADLINE ) {
+                if ( int err = _set_deadline(*attributes.deadline()) )
+                    return err;
+            }
+            else if ( attributes.policy() && (attributes.qos() || !_policy_in_attr(*attributes.policy())) ) {
+                struct sched_param param {};
+                param.sched_priority = attributes.priority();
+                if ( int err = pthread_setschedparam(pthread_self(), *attributes.policy(), &param) )
+                    return err;
+            }
+            if ( attributes.nice() )
+                if ( int err = _set_nice(*attributes.nice()) )
+                    return err;
+        #endif
+        return 0;
+    }
+
+    // The new thread exited without running, so reap it and report why
+    [[noreturn]] inline void _failed_start(Thread::native_handle_type& handle, int err) {
+        #if SIMPLY_WINDOWS
+            WaitForSingleObject(handle, INFINITE);
+            CloseHandle(handle);
+        #elif SIMPLY_LINUX
+            pthread_join(handle, nullptr);
+        #endif
+        handle = SIMPLY_NULL_THREAD;
+        throw std::system_error(err, std::system_category());
+    }
+
+    template <class T, size_t... I>
+    THREAD_RETURN_TYPE _invoke(void* lparg) noexcept {
+        const std::unique_ptr<T> arg_ptr(static_cast<T*>(lparg));
+        T& args = *arg_ptr;
+        #if SIMPLY_std20plus
+            _ControlEntry control(std::get<std::tuple_size_v<T> - 1>(args));
+        #endif
+        _RegistryEntry registered;
+        std::invoke(std::move(std::get<I>(args))...);
+        #if SIMPLY_WINDOWS
+            return 0;
+        #elif SIMPLY_LINUX
+            return nullptr;
+        #endif
+    }
+
+    template <class T, bool Inline, size_t... I>
+    THREAD_RETURN_TYPE _invoke_gated(void* lparg) noexcept {
+        _StartGate& gate = *static_cast<_StartGate*>(lparg);
+        #if SIMPLY_WINDOWS
+            gate.os_id = GetCurrentThreadId();
+        #elif SIMPLY_LINUX
+            gate.os_id = static_cast<uint64_t>(syscall(SYS_gettid));
+        #endif
+        T* payload = std::launder(static_cast<T*>(gate.payload));
+        // The attributes go with the creator's stack once notified
+        size_t arena_block_size = gate.attributes->arena();
+        _StackPrefault prefault;
+        int err = _prepare_thread(*gate.attributes);
+        if ( !err && gate.attributes->prefault_stack() )
+            err = prefault.lock(gate.attributes->prefault_stack());
+        if ( err ) {
+            if constexpr ( Inline )
+                payload->~T();
+            else
+                delete payload;
+            gate.error = err;
+            gate.notify();
+        }
+        else if constexpr ( Inline ) {
+            T args(std::move(*payload));
+            payload->~T();
+            // Registered before notifying, while the attributes are still there
+            _RegistryEntry registered(gate.attributes);
+            gate.notify();
+            #if SIMPLY_std20plus
+                _ControlEntry control(std::get<std::tuple_size_v<T> - 1>(args));
+            #endif
+            _ArenaEntry arena(arena_block_size);
+            std::invoke(std::move(std::get<I>(args))...);
+        }
+        else {
+            const std::unique_ptr<T> arg_ptr(payload);
+            _RegistryEntry registered(gate.attributes);
+            gate.notify();
+            #if SIMPLY_std20plus
+                _ControlEntry control(std::get<std::tuple_size_v<T> - 1>(*arg_ptr));
+            #endif
+            _ArenaEntry arena(arena_block_size);
+            std::invoke(std::move(std::get<I>(*arg_ptr))...);
+        }
+        #if SIMPLY_WINDOWS
+            return 0;
+        #elif SIMPLY_LINUX
+            return nullptr;
+        #endif
+    }
+
+    template <class T, size_t... I>
+    constexpr auto _invoker_get(std::index_sequence<I...>) noexcept {
+        return &_invoke<T, I...>;
+    }
+
+    template <class T, bool Inline, size_t... I>
+    constexpr auto _gated_invoker_get(std::index_sequence<I...>) noexcept {
+        return &_invoke_gated<T, Inline, I...>;
+    }
+
+    #if SIMPLY_LINUX
+        inline size_t _round_to_page(size_t size) noexcept {
+            size_t page = _page_size();
+            return (size + page - 1) / page * page;
+        }
+
+        // Owns a pthread_attr_t for the duration of pthread_create
+        struct _PthreadAttr {
+            pthread_attr_t attr;
+
+            _PthreadAttr() {
+                if ( int err = pthread_attr_init(&attr) )
+                    throw std::system_error(err, std::system_category());
+            }
+
+            ~_PthreadAttr() { pthread_attr_destroy(&attr); }
+
+            _PthreadAttr(const _PthreadAttr&) = delete;
+            _PthreadAttr& operator=(const _PthreadAttr&) = delete;
+
+            void set_stack(const _StackSpec& stack) {
+                int err = 0;
+                if ( stack.addr )
+                    err = pthread_attr_setstack(&attr, stack.addr, stack.size);
+                else if ( stack.size )
+                    err = pthread_attr_setstacksize(&attr, std::max<size_t>(PTHREAD_STACK_MIN, _round_to_page(stack.size)));
+                if ( !err && !stack.addr && stack.guard_size )
+                    err = pthread_attr_setguardsize(&attr, _round_to_page(stack.guard_size));
+                if ( err )
+                    throw std::system_error(err, std::system_category());
+            }
+
+            void set_affinity(const CpuSet& cpus) {
+                cpu_set_t set = _to_cpu_set(cpus);
+                if ( int err = pthread_attr_setaffinity_np(&attr, sizeof(set), &set) )
+                    throw std::system_error(err, std::system_category());
+            }
+
+            void set_scheduling(int policy, int priority) {
+                struct sched_param param {};
+                param.sched_priority = priority;
+                int err = pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+                if ( !err )
+                    err = pthread_attr_setschedpolicy(&attr, policy);
+                if ( !err )
+                    err = pthread_attr_setschedparam(&attr, &param);
+                if ( err )
+                    throw std::system_error(err, std::system_category());
+            }
+        };
+    #endif
+
+    template <class Routine>
+    void _create_native(const Thread::Attributes& attributes, const _StackSpec& stack, Thread::native_handle_type& handle, Routine routine, void* arg) {
+        #if SIMPLY_WINDOWS
+            // Anything that can be rejected up front is, before the thread exists
+            GROUP_AFFINITY affinity {0};
+            if ( attributes.affinity() )
+                affinity = _to_group_affinity(*attributes.affinity());
+            std::wstring wname;
+            if ( !attributes.name().empty() )
+                wname = _to_wstring(attributes.name());
+
+            bool configure = attributes.affinity() || attributes.priority() || attributes.qos() || !wname.empty();
+
+            uintptr_t h = _beginthreadex(
+                nullptr,
+                static_cast<unsigned>(stack.size),
+                routine,
+                arg,
+                configure ? CREATE_SUSPENDED : 0,
+                nullptr
+            );
+            
+            if ( h == 0 )
+                throw std::system_error(errno, std::system_category());
+        
+            handle = reinterpret_cast<HANDLE>(h);
+
+            if ( configure ) {
+                bool ok = true;
+                DWORD err = 0;
+                if ( ok && !wname.empty() ) {
+                    HRESULT hr = SetThreadDescription(handle, wname.c_str());
+                    if ( FAILED(hr) ) {
+                        ok = false;
+                        err = HRESULT_CODE(hr);
+                    }
+                }
+                if ( ok && attributes.affinity() && !(ok = SetThreadGroupAffinity(handle, &affinity, nullptr)) )
+                    err = GetLastError();
+                // Before the priority, so an explicit one wins over what it sets
+                if ( ok && attributes.qos() && (err = _set_qos(handle, *attributes.qos())) )
+                    ok = false;
+                if ( ok && attributes.priority() && !(ok = SetThreadPriority(handle, *attributes.priority())) )
+                    err = GetLastError();
+
+                if ( !ok ) {
+                    // The thread never ran, so nothing of the payload was touched
+                    TerminateThread(handle, 0);
+                    WaitForSingleObject(handle, INFINITE);
+                    CloseHandle(handle);
+                    handle = SIMPLY_NULL_THREAD;
+                    throw std::system_error(err, std::system_category());
+                }
+                ResumeThread(handle);
+            }
+
+        #elif SIMPLY_LINUX
+            _PthreadAttr attr;
+            attr.set_stack(stack);
+            if ( attributes.affinity() )
+                attr.set_affinity(*attributes.affinity());
+            if ( attributes.policy() && _policy_in_attr(*attributes.policy()) )
+                attr.set_scheduling(*attributes.policy(), attributes.priority());
+            int err = pthread_create(&handle, &attr.attr, routine, arg);
+
+            if ( err )
+                throw std::system_error(err, std::system_category());
+        
+        #endif
+    }
+
+    // Returns the OS id of the new thread - for Linux its tid, as it recorded it
+    template <class F, class... Args>
+    uint64_t _start(const Thread::Attributes& attributes, const _StackSpec& stack, TYPE_STOP_SOURCE stop_source, Thread::native_handle_type& handle, F&& f, Args&&... args) {
+        using T = _payload_type<F, Args...>;
+        using indices = decltype(_payload_indices<F, Args...>());
+        SIMPLY_TRACE_INSTANT("spawn");
+
+        if constexpr ( _starts_inline<T> ) {
+            // Small payloads wait on this stack for the new thread, instead of
+            // a malloc here and a cross-thread free there
+            _InlinePayload<T> storage;
+            T* payload = new (storage.storage) T(_make_payload<T>(stop_source, std::forward<F>(f), std::forward<Args>(args)...));
+            _StartGate gate {&attributes, payload};
+            try {
+                _create_native(attributes, stack, handle, _gated_invoker_get<T, true>(indices{}), &gate);
+            }
+            catch ( ... ) {
+                payload->~T();
+                throw;
+            }
+            gate.wait();
+            if ( gate.error )
+                _failed_start(handle, gate.error);
+            return gate.os_id;
+        }
+        else {
+            std::unique_ptr<T> data_copy(new T(_make_payload<T>(stop_source, std::forward<F>(f), std::forward<Args>(args)...)));
+            if ( _needs_gate(attributes) ) {
+                _StartGate gate {&attributes, data_copy.get()};
+                _create_native(attributes, stack, handle, _gated_invoker_get<T, false>(indices{}), &gate);
+                data_copy.release();
+                gate.wait();
+                if ( gate.error )
+                    _failed_start(handle, gate.error);
+                return gate.os_id;
+            }
+            _create_native(attributes, stack, handle, _invoker_get<T>(indices{}), data_copy.get());
+            data_copy.release();
+            #if SIMPLY_WINDOWS
+                return GetThreadId(handle);
+            #else
+                return 0;   // Not reached, Linux always takes the gate
+            #endif
+        }
+    }
+
+
+    #if SIMPLY_LINUX
+        // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        // ++ StackPool
+        // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+        inline StackPool::StackPool(size_t stack_size, size_t guard_size, bool prefault):
+            stack_size_(std::max<size_t>(PTHREAD_STACK_MIN, _round_to_page(stack_size))),
+            guard_size_(guard_size ? _round_to_page(guard_size) : _page_size()),
+            prefault_(prefault)
+        {}
+
+        inline StackPool::~StackPool() {
+            for ( void* mapping : free_ )
+                munmap(mapping, guard_size_ + stack_size_);
+        }
+
+        inline void StackPool::reserve(size_t count) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_.reserve(count);
+            while ( free_.size() < count )
+                free_.push_back(_map());
+        }
+
+        inline size_t StackPool::available() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return free_.size();
+        }
+
+        inline size_t StackPool::stack_size() const noexcept {
+            return stack_size_;
+        }
+
+        inline size_t StackPool::guard_size() const noexcept {
+            return guard_size_;
+        }
+
+        inline void* StackPool::_acquire() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if ( !free_.empty() ) {
+                    void* mapping = free_.back();
+                    free_.pop_back();
+                    return mapping;
+                }
+            }
+            return _map();
+        }
+
+        inline void StackPool::_release(void* mapping) noexcept {
+            std::lock_guard<std::mutex> lock(mutex_);
+            try {
+                free_.push_back(mapping);
+            }
+            catch ( ... ) {
+                munmap(mapping, guard_size_ + stack_size_);
+            }
+        }
+
+        inline void* StackPool::_map() const {
+            int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK;
+            if ( prefault_ )
+                flags |= MAP_POPULATE;
+            void* mapping = mmap(nullptr, guard_size_ + stack_size_, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if ( mapping == MAP_FAILED )
+                throw std::system_error(errno, std::system_category());
+            // Stacks grow down, so the guard sits at the start of the mapping
+            if ( mprotect(mapping, guard_size_, PROT_NONE) ) {
+                int err = errno;
+                munmap(mapping, guard_size_ + stack_size_);
+                throw std::system_error(err, std::system_category());
+            }
+            return mapping;
+        }
+    #endif
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ ThreadCache
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // What a standby thread started with, to put back between functions
+    #if SIMPLY_WINDOWS
+        struct _StandbyBaseline {
+            GROUP_AFFINITY affinity {};
+            int priority = THREAD_PRIORITY_NORMAL;
+        };
+
+    #elif SIMPLY_LINUX
+        struct _StandbyBaseline {
+            char name[16] = {};
+            cpu_set_t affinity;
+            _SchedAttr scheduling {};
+            int timer_slack = 0;
+        };
+    #endif
+
+    ///   _StandbyWorker {internal}
+    /// @brief A ThreadCache thread, and the function it was last handed
+    struct _StandbyWorker {
+        enum Command: uint32_t {
+            WAIT,
+            RUN,
+            EXIT
+        };
+
+        std::atomic<uint32_t> command{WAIT};
+        std::atomic<uint32_t> done{0};      // Set once the function returned, for joins to wait on
+        std::atomic<uint32_t> holders{0};   // The Thread and the thread itself, until each is done with the function
+        void (*run)(void*) = nullptr;
+        void* payload = nullptr;
+        bool clean = true;                  // Whether what the function changed on the thread was all undone
+        Thread::native_handle_type handle = SIMPLY_NULL_THREAD;
+
+        #if SIMPLY_LINUX
+            std::atomic<uint32_t> tid{0};   // Recorded by the thread as it starts
+        #endif
+    };
+
+    struct _StandbyCache {
+        std::mutex mutex;
+        std::vector<_StandbyWorker*> parked;    // Last parked at the back, as the warmest
+        size_t max_parked = 0;
+        std::atomic<int64_t> idle_timeout_ms{0};
+        std::atomic<bool> enabled{false};
+        std::atomic<uint64_t> spawned{0};
+        std::atomic<uint64_t> reused{0};
+    };
+
+    // Never destroyed, as parked threads outlive static destruction
+    inline _StandbyCache& _standby_cache() noexcept {
+        static _StandbyCache* cache = new _StandbyCache;
+        return *cache;
+    }
+
+    template <class T, size_t... I>
+    void _standby_invoke(void* payload) noexcept {
+        _invoke<T, I...>(payload);
+    }
+
+    template <class T, size_t... I>
+    constexpr auto _standby_invoker_get(std::index_sequence<I...>) noexcept {
+        return &_standby_invoke<T, I...>;
+    }
+
+    #if SIMPLY_WINDOWS
+        inline void _standby_snapshot(_StandbyBaseline& baseline) noexcept {
+            GetThreadGroupAffinity(GetCurrentThread(), &baseline.affinity);
+            baseline.priority = GetThreadPriority(GetCurrentThread());
+        }
+
+        // Returns `false` if the thread can't be put back as it started
+        inline bool _standby_restore(const _StandbyBaseline& baseline) noexcept {
+            HANDLE self = GetCurrentThread();
+            if ( FAILED(SetThreadDescription(self, L"")) || _set_qos(self, Thread::QoS::DEFAULT) )
+                return false;
+            GROUP_AFFINITY affinity {};
+            if ( !GetThreadGroupAffinity(self, &affinity) )
+                return false;
+            if ( (affinity.Group != baseline.affinity.Group || affinity.Mask != baseline.affinity.Mask) &&
+                 !SetThreadGroupAffinity(self, &baseline.affinity, nullptr) )
+                return false;
+            return GetThreadPriority(self) == baseline.priority || SetThreadPriority(self, baseline.priority);
+        }
+
+    #elif SIMPLY_LINUX
+        inline void _standby_snapshot(_StandbyBaseline& baseline) noexcept {
+            prctl(PR_GET_NAME, baseline.name, 0, 0, 0);
+            CPU_ZERO(&baseline.affinity);
+            sched_getaffinity(0, sizeof(baseline.affinity), &baseline.affinity);
+            syscall(SYS_sched_getattr, 0, &baseline.scheduling, sizeof(baseline.scheduling), 0);
+            baseline.timer_slack = prctl(PR_GET_TIMERSLACK, 0, 0, 0, 0);
+        }
+
+        // Returns `false` if the thread can't be put back as it started - such
+        // as a raised nice, which only privileged threads may lower again.
+        // Each is read first, as unchanged is by far the common case
+        inline bool _standby_restore(const _StandbyBaseline& baseline) noexcept {
+            char name[16] = {};
+            prctl(PR_GET_NAME, name, 0, 0, 0);
+            if ( std::strcmp(name, baseline.name) )
+                prctl(PR_SET_NAME, baseline.name, 0, 0, 0);
+
+            cpu_set_t affinity;
+            CPU_ZERO(&affinity);
+            if ( sched_getaffinity(0, sizeof(affinity), &affinity) )
+                return false;
+            if ( !CPU_EQUAL(&affinity, &baseline.affinity) && sched_setaffinity(0, sizeof(baseline.affinity), &baseline.affinity) )
+                return false;
+
+            _SchedAttr now {};
+            if ( syscall(SYS_sched_getattr, 0, &now, sizeof(now), 0) )
+                return false;
+            const _SchedAttr& was = baseline.scheduling;
+            bool clamped = now.sched_util_min != was.sched_util_min || now.sched_util_max != was.sched_util_max;
+            if ( clamped || now.sched_policy != was.sched_policy || now.sched_nice != was.sched_nice || now.sched_priority != was.sched_priority ) {
+                _SchedAttr attr = was;
+                attr.size = sizeof(attr);
+                attr.sched_flags = (was.sched_flags & _sched_flag_reset_on_fork) | (clamped ? _sched_flag_util_clamp : 0);
+                if ( syscall(SYS_sched_setattr, 0, &attr, 0) )
+                    return false;
+            }
+
+            int slack = prctl(PR_GET_TIMERSLACK, 0, 0, 0, 0);
+            return slack == baseline.timer_slack || !prctl(PR_SET_TIMERSLACK, baseline.timer_slack, 0, 0, 0);
+        }
+    #endif
+
+    inline void _standby_exit(_StandbyWorker* worker) noexcept {
+        worker->command.store(_StandbyWorker::EXIT, std::memory_order_release);
+        _futex_wake_all(worker->command);
+    }
+
+    // By the Thread once joined or detached, and by the thread once the
+    // function returned - the last of the two parks it, or has it exit
+    inline void _standby_release(_StandbyWorker* worker) noexcept {
+        if ( worker->holders.fetch_sub(1, std::memory_order_acq_rel) != 1 )
+            return;
+        _StandbyCache& cache = _standby_cache();
+        if ( worker->clean && cache.enabled.load(std::memory_order_relaxed) ) {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            if ( cache.parked.size() < cache.max_parked ) {
+                cache.parked.push_back(worker);
+                return;
+            }
+        }
+        _standby_exit(worker);
+    }
+
+    inline THREAD_RETURN_TYPE _standby_main(void* arg) noexcept {
+        _StandbyWorker* worker = static_cast<_StandbyWorker*>(arg);
+        #if SIMPLY_LINUX
+            worker->tid.store(static_cast<uint32_t>(syscall(SYS_gettid)), std::memory_order_release);
+            _futex_wake_all(worker->tid);
+        #endif
+        _StandbyCache& cache = _standby_cache();
+        _StandbyBaseline baseline;
+        _standby_snapshot(baseline);
+        for ( ;; ) {
+            // Handed a function when created, or later while parked
+            uint32_t command;
+            while ( (command = worker->command.load(std::memory_order_acquire)) == _StandbyWorker::WAIT ) {
+                auto timeout = std::chrono::milliseconds(cache.idle_timeout_ms.load(std::memory_order_relaxed));
+                if ( _futex_wait_until(worker->command, _StandbyWorker::WAIT, std::chrono::steady_clock::now() + timeout) )
+                    continue;
+                // Idle for too long, so leave - unless held, or being handed a function right now
+                std::lock_guard<std::mutex> lock(cache.mutex);
+                auto at = std::find(cache.parked.begin(), cache.parked.end(), worker);
+                if ( at != cache.parked.end() ) {
+                    cache.parked.erase(at);
+                    worker->command.store(_StandbyWorker::EXIT, std::memory_order_relaxed);
+                }
+            }
+            if ( command == _StandbyWorker::EXIT )
+                break;
+
+            worker->command.store(_StandbyWorker::WAIT, std::memory_order_relaxed);
+            worker->run(worker->payload);
+            worker->done.store(1, std::memory_order_release);
+            _futex_wake_all(worker->done);
+
+            worker->clean = _standby_restore(baseline);
+            _control_self().forget();
+            _standby_release(worker);
+        }
+
         #if SIMPLY_WINDOWS
+            CloseHandle(worker->handle);
+            delete worker;
             return 0;
         #elif SIMPLY_LINUX
+            delete worker;
             return nullptr;
         #endif
     }
 
-    template <class T, size_t... I>
-    constexpr auto _invoker_get(std::index_sequence<I...>) noexcept {
-        return &_invoke<T, I...>;
+    // Hands the function to a parked thread, or a new one, with both holders taken
+    inline _StandbyWorker* _standby_start(void (*run)(void*), void* payload) {
+        _StandbyCache& cache = _standby_cache();
+        _StandbyWorker* worker = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            if ( !cache.parked.empty() ) {
+                worker = cache.parked.back();
+                cache.parked.pop_back();
+            }
+        }
+        if ( worker ) {
+            worker->run = run;
+            worker->payload = payload;
+            worker->done.store(0, std::memory_order_relaxed);
+            worker->holders.store(2, std::memory_order_relaxed);
+            worker->command.store(_StandbyWorker::RUN, std::memory_order_release);
+            _futex_wake_one(worker->command);
+            cache.reused.fetch_add(1, std::memory_order_relaxed);
+            return worker;
+        }
+
+        std::unique_ptr<_StandbyWorker> fresh(new _StandbyWorker);
+        fresh->run = run;
+        fresh->payload = payload;
+        fresh->holders.store(2, std::memory_order_relaxed);
+        fresh->command.store(_StandbyWorker::RUN, std::memory_order_relaxed);
+        _create_native(Thread::Attributes(), _StackSpec(), fresh->handle, &_standby_main, fresh.get());
+        #if SIMPLY_LINUX
+            // Nothing joins it, it deletes itself on exit
+            pthread_detach(fresh->handle);
+        #endif
+        cache.spawned.fetch_add(1, std::memory_order_relaxed);
+        return fresh.release();
     }
 
-    template <class F, class... Args>
-    void _start(size_t stack_size, TYPE_STOP_SOURCE stop_source, Thread::native_handle_type& handle, F&& f, Args&&... args) {
-        #if SIMPLY_std20plus
-            constexpr bool takes_stop_token = std::is_invocable_v<F, std::stop_token, Args...>;
+    inline bool _standby_wait_until(_StandbyWorker* worker, std::chrono::steady_clock::time_point deadline) noexcept {
+        bool forever = deadline == std::chrono::steady_clock::time_point::max();
+        while ( !worker->done.load(std::memory_order_acquire) ) {
+            if ( forever )
+                _futex_wait(worker->done, 0);
+            else if ( !_futex_wait_until(worker->done, 0, deadline) )
+                return worker->done.load(std::memory_order_acquire) != 0;
+        }
+        return true;
+    }
 
-            using T = std::conditional_t<
-                takes_stop_token,
-                std::tuple<std::decay_t<F>, std::stop_token, std::decay_t<Args>...>,
-                std::tuple<std::decay_t<F>, std::decay_t<Args>...>
-            >;
+    inline void ThreadCache::enable(size_t max_parked, std::chrono::milliseconds idle_timeout) {
+        _StandbyCache& cache = _standby_cache();
+        std::vector<_StandbyWorker*> excess;
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            cache.max_parked = max_parked;
+            cache.idle_timeout_ms.store(idle_timeout.count(), std::memory_order_relaxed);
+            cache.enabled.store(true, std::memory_order_relaxed);
+            // The coldest go first
+            size_t over = cache.parked.size() > max_parked ? cache.parked.size() - max_parked : 0;
+            excess.assign(cache.parked.begin(), cache.parked.begin() + over);
+            cache.parked.erase(cache.parked.begin(), cache.parked.begin() + over);
+        }
+        for ( _StandbyWorker* worker : excess )
+            _standby_exit(worker);
+    }
 
-            std::unique_ptr<T> data_copy;
+    inline void ThreadCache::disable() noexcept {
+        _StandbyCache& cache = _standby_cache();
+        std::vector<_StandbyWorker*> parked;
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            cache.enabled.store(false, std::memory_order_relaxed);
+            cache.max_parked = 0;
+            parked.swap(cache.parked);
+        }
+        for ( _StandbyWorker* worker : parked )
+            _standby_exit(worker);
+    }
 
-            if constexpr ( takes_stop_token ) {
-                static_assert(std::is_invocable_v<F, std::stop_token, Args...>,
-                    "Thread function/args (w/ stop_token) are malformed..."
-                );
-                data_copy = std::make_unique<T>(
-                    std::forward<F>(f),
-                    std::forward<std::stop_token>(stop_source.get_token()),
-                    std::forward<Args>(args)...
-                );
-            }
-            else {
-                static_assert(std::is_invocable_v<F, Args...>, "Thread function/args are malformed...");
-                data_copy = std::make_unique<T>(std::forward<F>(f), std::forward<Args>(args)...);
-            }
+    inline bool ThreadCache::enabled() noexcept {
+        return _standby_cache().enabled.load(std::memory_order_relaxed);
+    }
 
-            constexpr auto invoker = _invoker_get<T>(std::make_index_sequence<std::tuple_size_v<T>>{});
-        #else
-            using T = std::tuple<std::decay_t<F>, std::decay_t<Args>...>;
+    inline ThreadCache::Stats ThreadCache::stats() noexcept {
+        _StandbyCache& cache = _standby_cache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        return Stats{
+            cache.spawned.load(std::memory_order_relaxed),
+            cache.reused.load(std::memory_order_relaxed),
+            cache.parked.size()
+        };
+    }
 
-            static_assert(std::is_invocable_v<F, Args...>, "Thread function/args are malformed...");
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Thread::Attributes
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline Thread::Attributes& Thread::Attributes::stack_size(size_t bytes) noexcept {
+        stack_size_ = bytes;
+        return *this;
+    }
 
-            std::unique_ptr<T> data_copy = std::make_unique<T>(std::forward<F>(f), std::forward<Args>(args)...);
+    inline Thread::Attributes& Thread::Attributes::guard_size(size_t bytes) noexcept {
+        guard_size_ = bytes;
+        return *this;
+    }
 
-            constexpr auto invoker = _invoker_get<T>(std::make_index_sequence<std::tuple_size_v<T>>{});
-        #endif
+    #if SIMPLY_LINUX
+        inline Thread::Attributes& Thread::Attributes::stack_pool(StackPool& pool) noexcept {
+            stack_pool_ = &pool;
+            return *this;
+        }
+    #endif
 
-        #if SIMPLY_WINDOWS
-            uintptr_t h = _beginthreadex(
-                nullptr,
-                stack_size,
-                invoker,
-                data_copy.get(),
-                0,
-                nullptr
+    inline Thread::Attributes& Thread::Attributes::affinity(const CpuSet& cpus) {
+        if ( cpus.empty() )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "Thread::Attributes::affinity: CpuSet must not be empty!"
             );
-            
-            if ( h == -1L )
-                throw std::system_error(errno, std::system_category());
-        
-            handle = reinterpret_cast<HANDLE>(h);
-
-        #elif SIMPLY_LINUX
-            /// @todo - assign stack size using arg 2 (NULL)
-            int err = pthread_create(&handle, NULL, invoker, data_copy.get());
-
-            if ( err )
-                throw std::system_error(err, std::system_category());
-        
-        #endif
-
-        data_copy.release();
+        affinity_ = cpus;
+        return *this;
     }
 
     #if SIMPLY_WINDOWS
-        inline std::string _from_wstring(const std::wstring& wname) noexcept {
-            size_t len = std::wcstombs(nullptr, wname.c_str(), 0) + 1;
-            char* buffer = new char[len];
-            std::wcstombs(buffer, wname.c_str(), len);
-            std::string name(buffer);
-            delete[] buffer;
-            return name;
+        inline Thread::Attributes& Thread::Attributes::priority(Priority priority) noexcept {
+            priority_ = priority;
+            return *this;
         }
 
-        inline std::wstring _to_wstring(const std::string& name) noexcept {
-            size_t len = std::mbstowcs(nullptr, name.c_str(), 0) + 1;
-            wchar_t* buffer = new wchar_t[len];
-            std::mbstowcs(buffer, name.c_str(), len);
-            std::wstring wname(buffer);
-            delete[] buffer;
-            return wname;
+    #elif SIMPLY_LINUX
+        inline Thread::Attributes& Thread::Attributes::scheduling(Policy policy, int priority) {
+            _check_scheduling(policy, priority, "Thread::Attributes::scheduling");
+            policy_ = policy;
+            priority_ = priority;
+            deadline_.reset();
+            return *this;
         }
 
-        inline std::wstring _get_wide_name(HANDLE handle) {
-            PWSTR description = nullptr;
-            GetThreadDescription(handle, &description); // Check error...
-            std::wstring wname(description);
-            LocalFree(description); // Check error...
-            return wname;
+        inline Thread::Attributes& Thread::Attributes::deadline(std::chrono::nanoseconds runtime, std::chrono::nanoseconds deadline, std::chrono::nanoseconds period) {
+            Deadline parameters {runtime, deadline, period};
+            _check_deadline(parameters, "Thread::Attributes::deadline");
+            policy_ = Policy::DEADLINE;
+            priority_ = 0;
+            deadline_ = parameters;
+            return *this;
         }
 
-        inline void _set_wide_name(HANDLE handle, const std::wstring& wname) {
-            SetThreadDescription(handle, wname.c_str());
+        inline Thread::Attributes& Thread::Attributes::nice(int nice) {
+            _check_nice(nice, "Thread::Attributes::nice");
+            nice_ = nice;
+            return *this;
         }
+    #endif
 
-        inline std::string _get_name(HANDLE handle) {
-            return _from_wstring(_get_wide_name(handle));
+    inline Thread::Attributes& Thread::Attributes::qos(QoS qos) noexcept {
+        qos_ = qos;
+        return *this;
+    }
+
+    inline Thread::Attributes& Thread::Attributes::name(const std::string& name) {
+        #if SIMPLY_LINUX
+            if ( name.size() > 15 )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "Thread::Attributes::name: Linux only supports 15 chars followed by NULL for name"
+                );
+        #endif
+        name_ = name;
+        return *this;
+    }
+
+    inline size_t Thread::Attributes::stack_size() const noexcept {
+        return stack_size_;
+    }
+
+    inline size_t Thread::Attributes::guard_size() const noexcept {
+        return guard_size_;
+    }
+
+    #if SIMPLY_LINUX
+        inline StackPool* Thread::Attributes::stack_pool() const noexcept {
+            return stack_pool_;
         }
+    #endif
 
-        inline void _set_name(HANDLE handle, const std::string& name) {
-            _set_wide_name(handle, _to_wstring(name));
+    inline const std::optional<CpuSet>& Thread::Attributes::affinity() const noexcept {
+        return affinity_;
+    }
+
+    #if SIMPLY_WINDOWS
+        inline const std::optional<Thread::Priority>& Thread::Attributes::priority() const noexcept {
+            return priority_;
         }
 
     #elif SIMPLY_LINUX
-        inline std::string _get_name(pthread_t thread) {
-            char name[16];
-            pthread_getname_np(thread, name, sizeof(name));
-            return name;
+        inline const std::optional<Thread::Policy>& Thread::Attributes::policy() const noexcept {
+            return policy_;
         }
 
-        inline void _set_name(pthread_t thread, const std::string& name) {
-            if ( name.size() > 15 )
-                throw std::system_error(
-                    std::make_error_code(std::errc::invalid_argument),
-                    "this_thread::set_name: Linux only supports 15 chars followed by NULL for name"
-                );
-            pthread_setname_np(thread, name.c_str());
+        inline int Thread::Attributes::priority() const noexcept {
+            return priority_;
+        }
+
+        inline const std::optional<Thread::Deadline>& Thread::Attributes::deadline() const noexcept {
+            return deadline_;
+        }
+
+        inline const std::optional<int>& Thread::Attributes::nice() const noexcept {
+            return nice_;
         }
-        
     #endif
 
-    Thread::Thread() noexcept: handle_(SIMPLY_NULL_THREAD) {}
+    inline const std::optional<Thread::QoS>& Thread::Attributes::qos() const noexcept {
+        return qos_;
+    }
+
+    inline const std::string& Thread::Attributes::name() const noexcept {
+        return name_;
+    }
+
+    inline Thread::Attributes& Thread::Attributes::arena(size_t block_size) noexcept {
+        arena_ = block_size;
+        return *this;
+    }
+
+    inline size_t Thread::Attributes::arena() const noexcept {
+        return arena_;
+    }
+
+    inline Thread::Attributes& Thread::Attributes::prefault_stack(size_t bytes) noexcept {
+        prefault_stack_ = bytes;
+        return *this;
+    }
+
+    inline size_t Thread::Attributes::prefault_stack() const noexcept {
+        return prefault_stack_;
+    }
+
+    #if SIMPLY_LINUX
+        Thread::Thread() noexcept: handle_(SIMPLY_NULL_THREAD), standby_(nullptr), tid_(0), stack_pool_(nullptr), stack_(nullptr) {}
+    #else
+        Thread::Thread() noexcept: handle_(SIMPLY_NULL_THREAD), standby_(nullptr) {}
+    #endif
 
     /* === Constructor === ++++++++++++++++++++++++++++++ */
-    template <class F, class... Args>
+    template <class F, class... Args, std::enable_if_t<!_is_thread_option<F>::value, int>>
     Thread::Thread(F&& f, Args&&... args): Thread() {
-        #if SIMPLY_std20plus
-            _start(0, stop_source_, handle_, std::forward<F>(f), std::forward<Args>(args)...);
+        if ( _standby_cache().enabled.load(std::memory_order_relaxed) )
+            _construct_standby(std::forward<F>(f), std::forward<Args>(args)...);
+        else
+            _construct(Attributes(), std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template <class F, class... Args>
+    Thread::Thread(size_t stack_size, F&& f, Args&&... args): Thread(Attributes().stack_size(stack_size), std::forward<F>(f), std::forward<Args>(args)...) {}
+
+    #if SIMPLY_LINUX
+        template <class F, class... Args>
+        Thread::Thread(StackPool& stack_pool, F&& f, Args&&... args): Thread(Attributes().stack_pool(stack_pool), std::forward<F>(f), std::forward<Args>(args)...) {}
+    #endif
+
+    template <class F, class... Args>
+    Thread::Thread(const Attributes& attributes, F&& f, Args&&... args): Thread() {
+        _construct(attributes, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template <class F, class... Args>
+    void Thread::_construct(const Attributes& attributes, F&& f, Args&&... args) {
+        _StackSpec stack;
+        stack.size = attributes.stack_size();
+        stack.guard_size = attributes.guard_size();
+
+        #if SIMPLY_LINUX
+            StackPool* pool = attributes.stack_pool();
+            void* mapping = nullptr;
+            if ( pool ) {
+                mapping = pool->_acquire();
+                stack.size = pool->stack_size();
+                stack.addr = static_cast<char*>(mapping) + pool->guard_size();
+            }
+            try {
+                #if SIMPLY_std20plus
+                    tid_ = static_cast<pid_t>(_start(attributes, stack, stop_source_, handle_, std::forward<F>(f), std::forward<Args>(args)...));
+                #else
+                    tid_ = static_cast<pid_t>(_start(attributes, stack, nullptr, handle_, std::forward<F>(f), std::forward<Args>(args)...));
+                #endif
+            }
+            catch ( ... ) {
+                if ( pool )
+                    pool->_release(mapping);
+                throw;
+            }
+            stack_pool_ = pool;
+            stack_ = mapping;
+
         #else
-            _start(0, nullptr, handle_, std::forward<F>(f), std::forward<Args>(args)...);
+            #if SIMPLY_std20plus
+                _start(attributes, stack, stop_source_, handle_, std::forward<F>(f), std::forward<Args>(args)...);
+            #else
+                _start(attributes, stack, nullptr, handle_, std::forward<F>(f), std::forward<Args>(args)...);
+            #endif
         #endif
     }
 
     template <class F, class... Args>
-    Thread::Thread(size_t stack_size, F&& f, Args&&... args): Thread() {
+    void Thread::_construct_standby(F&& f, Args&&... args) {
+        using T = _payload_type<F, Args...>;
+        using indices = decltype(_payload_indices<F, Args...>());
+        SIMPLY_TRACE_INSTANT("spawn");
         #if SIMPLY_std20plus
-            _start(stack_size, stop_source_, handle_, std::forward<F>(f), std::forward<Args>(args)...);
+            std::unique_ptr<T> payload(new T(_make_payload<T>(stop_source_, std::forward<F>(f), std::forward<Args>(args)...)));
         #else
-            _start(stack_size, nullptr, handle_, std::forward<F>(f), std::forward<Args>(args)...);
+            std::unique_ptr<T> payload(new T(_make_payload<T>(nullptr, std::forward<F>(f), std::forward<Args>(args)...)));
         #endif
+        standby_ = _standby_start(_standby_invoker_get<T>(indices{}), payload.get());
+        payload.release();
+        handle_ = standby_->handle;
     }
 
     Thread::~Thread() {
@@ -637,9 +4186,15 @@ namespace simply {
 
     void Thread::swap(Thread& other) noexcept {
         std::swap(handle_, other.handle_);
+        std::swap(standby_, other.standby_);
         #if SIMPLY_std20plus
             std::swap(stop_source_, other.stop_source_);
         #endif
+        #if SIMPLY_LINUX
+            std::swap(tid_, other.tid_);
+            std::swap(stack_pool_, other.stack_pool_);
+            std::swap(stack_, other.stack_);
+        #endif
     }
 
     bool Thread::joinable() const noexcept {
@@ -660,26 +4215,52 @@ namespace simply {
     #if SIMPLY_WINDOWS
         void Thread::join() {
             _ensure_joinable("join");
+            SIMPLY_TRACE_SCOPE("join");
             #if SIMPLY_std20plus
                 request_stop();
             #endif
+            if ( standby_ ) {
+                _standby_join_until(std::chrono::steady_clock::time_point::max());
+                return;
+            }
             if ( WaitForSingleObject(handle_, INFINITE) != WAIT_OBJECT_0 )
                 throw std::system_error(GetLastError(), std::system_category());
+            CloseHandle(handle_);
             _reset();
         }
 
-        bool Thread::join(ms_type ms_timeout) {
-            _ensure_joinable("join");
+        inline bool Thread::_join_until(std::chrono::steady_clock::time_point deadline) {
+            SIMPLY_TRACE_SCOPE("join");
             #if SIMPLY_std20plus
                 request_stop();
             #endif
-            if ( ms_timeout == std::numeric_limits<DWORD>::max() )
-                throw std::system_error(
-                    std::make_error_code(std::errc::invalid_argument),
-                    "Thread::join: Windows timeouts must be less than 0xFFFFFFFF!"
-                );
-            switch ( WaitForSingleObject(handle_, ms_timeout) ) {
+            if ( standby_ )
+                return _standby_join_until(deadline);
+            auto remaining = deadline - std::chrono::steady_clock::now();
+            DWORD result;
+            if ( remaining.count() <= 0 ) {
+                result = WaitForSingleObject(handle_, 0);
+            }
+            else if ( HANDLE timer = _arm_sleep_timer(remaining) ) {
+                // Whichever is first, the thread exiting or the timer firing
+                HANDLE handles[2] = {handle_, timer};
+                result = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+                if ( result == WAIT_OBJECT_0 + 1 )
+                    result = WaitForSingleObject(handle_, 0);
+                else
+                    CancelWaitableTimer(timer);
+            }
+            else {
+                // Older than Windows 10 1803, so only millisecond waits
+                do {
+                    auto ms = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+                    result = WaitForSingleObject(handle_, static_cast<DWORD>(std::min<long long>(ms, max_timeout())));
+                    remaining = deadline - std::chrono::steady_clock::now();
+                } while ( result == WAIT_TIMEOUT && remaining.count() > 0 );
+            }
+            switch ( result ) {
                 case WAIT_OBJECT_0:
+                    CloseHandle(handle_);
                     _reset();
                     return true;
                 
@@ -694,33 +4275,35 @@ namespace simply {
     #elif SIMPLY_LINUX
         void Thread::join() {
             _ensure_joinable("join");
+            SIMPLY_TRACE_SCOPE("join");
             #if SIMPLY_std20plus
                 request_stop();
             #endif
+            if ( standby_ ) {
+                _standby_join_until(std::chrono::steady_clock::time_point::max());
+                return;
+            }
             if ( int err = pthread_join(handle_, NULL) )
                 throw std::system_error(err, std::system_category());
             _reset();
         }
 
-        void _join_timeout(ms_type ms_timeout, struct timespec* ts) {
-            if ( clock_gettime(CLOCK_REALTIME, ts ) )
-                throw std::system_error(errno, std::system_category());
-            ts->tv_sec += ms_timeout / 1000;
-            ts->tv_nsec += (ms_timeout % 1000) * 1000000;
-            if ( ts->tv_nsec > 999999999 ) {
-                ts->tv_sec  += 1;
-                ts->tv_nsec %= 1000000000;
-            }
-        }
-
-        bool Thread::join(ms_type ms_timeout) {
-            _ensure_joinable("join");
+        inline bool Thread::_join_until(std::chrono::steady_clock::time_point deadline) {
+            SIMPLY_TRACE_SCOPE("join");
             #if SIMPLY_std20plus
                 request_stop();
             #endif
-            struct timespec timeout; 
-            _join_timeout(ms_timeout, &timeout);
-            int err = pthread_timedjoin_np(handle_, NULL, &timeout);
+            if ( standby_ )
+                return _standby_join_until(deadline);
+            #if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 31))
+                struct timespec timeout = _to_timespec(deadline.time_since_epoch());
+                int err = pthread_clockjoin_np(handle_, NULL, CLOCK_MONOTONIC, &timeout);
+            #else
+                // Without pthread_clockjoin_np, the deadline has to be moved to CLOCK_REALTIME
+                auto remaining = deadline - std::chrono::steady_clock::now();
+                struct timespec timeout = _to_timespec(std::chrono::system_clock::now().time_since_epoch() + remaining);
+                int err = pthread_timedjoin_np(handle_, NULL, &timeout);
+            #endif
             switch ( err ) {
                 case ETIMEDOUT:
                     return false;
@@ -736,64 +4319,277 @@ namespace simply {
 
     #endif
 
+    inline bool Thread::_standby_join_until(std::chrono::steady_clock::time_point deadline) {
+        // Its function can't return while it waits for itself
+        if ( Thread::id(handle_) == this_thread::get_id() )
+            throw std::system_error(
+                std::make_error_code(std::errc::resource_deadlock_would_occur),
+                "Thread::join: Can't join a thread from itself!"
+            );
+        if ( !_standby_wait_until(standby_, deadline) )
+            return false;
+        _standby_release(standby_);
+        _reset();
+        return true;
+    }
+
+    inline bool Thread::join(ms_type ms_timeout) {
+        _ensure_joinable("join");
+        return _join_until(_steady_deadline(std::chrono::milliseconds(ms_timeout)));
+    }
+
     template <class Rep, class Period>
     bool Thread::join_for(const std::chrono::duration<Rep, Period>& timeout_duration) {
         _ensure_joinable("join_for");
-        return this->join_until(std::chrono::steady_clock::now() + timeout_duration);
+        return _join_until(_steady_deadline(timeout_duration));
     }
 
     template <class Clock, class Duration>
     bool Thread::join_until(const std::chrono::time_point<Clock, Duration>& timeout_time) {
         _ensure_joinable("join_until");
-        bool joined = false;
-        while (
-            (Clock::now() + std::chrono::milliseconds(this->max_timeout()) < timeout_time) &&
-            !(joined = this->join(this->max_timeout()))
-        )
-            ;
-        if ( joined )
+        if constexpr ( std::is_same_v<Clock, std::chrono::steady_clock> ) {
+            return _join_until(std::chrono::ceil<std::chrono::steady_clock::duration>(timeout_time));
+        }
+        else {
+            while ( !_join_until(_steady_deadline(timeout_time - Clock::now())) )
+                if ( Clock::now() >= timeout_time )
+                    return false;
             return true;
-        auto d = std::chrono::duration_cast<std::chrono::milliseconds>(timeout_time - Clock::now()).count();
-        return this->join(d);
+        }
+    }
+
+    #if SIMPLY_WINDOWS
+        void Thread::detach() {
+            _ensure_joinable("detach");
+            if ( standby_ )
+                _standby_release(standby_);
+            else
+                CloseHandle(handle_);
+            _reset();
+        }
+
+    #elif SIMPLY_LINUX
+        void Thread::detach() {
+            _ensure_joinable("detach");
+            if ( stack_pool_ )
+                throw std::system_error(
+                    std::make_error_code(std::errc::operation_not_permitted),
+                    "Thread::detach: Can't detach a thread running on a StackPool stack!"
+                );
+            if ( standby_ )
+                _standby_release(standby_);
+            else
+                pthread_detach(handle_);
+            _reset();
+        }
+    #endif
+
+    void Thread::set_name(const std::string& name) {
+        _ensure_joinable("set_name");
+        _set_name(handle_, name);
+        _control_changed();
+    }
+
+    std::string Thread::get_name() const {
+        _ensure_joinable("get_name");
+        return _get_name(handle_);
+    }
+
+    #if SIMPLY_WINDOWS
+        void Thread::set_wide_name(const std::wstring& wname) {
+            _ensure_joinable("set_wide_name");
+            _set_wide_name(handle_, wname);
+            _control_changed();
+        }
+
+        std::wstring Thread::get_wide_name() const {
+            _ensure_joinable("get_wide_name");
+            return _get_wide_name(handle_);
+        }
+    #endif
+
+    void Thread::set_affinity(const CpuSet& cpus) {
+        _ensure_joinable("set_affinity");
+        _set_affinity(handle_, cpus);
+        _control_changed();
+    }
+
+    CpuSet Thread::get_affinity() const {
+        _ensure_joinable("get_affinity");
+        return _get_affinity(handle_);
+    }
+
+    #if SIMPLY_WINDOWS
+        inline void Thread::set_priority(Priority priority) {
+            _ensure_joinable("set_priority");
+            _set_priority(handle_, priority);
+            _control_changed();
+        }
+
+        inline Thread::Priority Thread::get_priority() const {
+            _ensure_joinable("get_priority");
+            return _get_priority(handle_);
+        }
+
+    #elif SIMPLY_LINUX
+        inline void Thread::set_scheduling(Policy policy, int priority) {
+            _ensure_joinable("set_scheduling");
+            _check_scheduling(policy, priority, "Thread::set_scheduling");
+            _set_scheduling(handle_, policy, priority);
+            _control_changed();
+        }
+
+        inline Thread::Policy Thread::get_policy() const {
+            _ensure_joinable("get_policy");
+            return _get_policy(handle_);
+        }
+
+        inline int Thread::get_priority() const {
+            _ensure_joinable("get_priority");
+            int priority;
+            _get_policy(handle_, &priority);
+            return priority;
+        }
+    #endif
+
+    inline void Thread::set_qos(QoS qos) {
+        _ensure_joinable("set_qos");
+        #if SIMPLY_WINDOWS
+            if ( DWORD err = _set_qos(handle_, qos) )
+                throw std::system_error(err, std::system_category());
+        #elif SIMPLY_LINUX
+            // The timer slack of the calling thread needs no privilege
+            pid_t tid = pthread_equal(handle_, pthread_self()) ? 0 : _tid();
+            if ( int err = _set_qos(tid, qos) )
+                throw std::system_error(err, std::system_category());
+        #endif
+        _control_changed();
+    }
+
+    inline Thread::QoS Thread::get_qos() const {
+        _ensure_joinable("get_qos");
+        #if SIMPLY_WINDOWS
+            return _get_qos(handle_);
+        #elif SIMPLY_LINUX
+            return _get_qos(_tid());
+        #endif
     }
 
     #if SIMPLY_WINDOWS
-        void Thread::detach() {
-            _ensure_joinable("detach");
-            CloseHandle(handle_);
-            _reset();
+        inline std::chrono::nanoseconds _from_filetime(const FILETIME& time) noexcept {
+            ULARGE_INTEGER ticks;
+            ticks.LowPart = time.dwLowDateTime;
+            ticks.HighPart = time.dwHighDateTime;
+            return std::chrono::nanoseconds(ticks.QuadPart * 100);
+        }
+
+        inline Thread::Stats _stats_of(HANDLE thread) {
+            Thread::Stats stats {};
+            FILETIME created, exited, kernel, user;
+            if ( !GetThreadTimes(thread, &created, &exited, &kernel, &user) )
+                throw std::system_error(GetLastError(), std::system_category());
+            stats.user_time = _from_filetime(user);
+            stats.system_time = _from_filetime(kernel);
+            stats.cpu_time = stats.user_time + stats.system_time;
+            ULONG64 cycles = 0;
+            if ( QueryThreadCycleTime(thread, &cycles) )
+                stats.cycles = cycles;
+            PROCESSOR_NUMBER processor;
+            if ( GetThreadIdealProcessorEx(thread, &processor) )
+                stats.cpu = processor.Group * 64 + processor.Number;
+            return stats;
         }
 
     #elif SIMPLY_LINUX
-        void Thread::detach() {
-            _ensure_joinable("detach");
-            pthread_detach(handle_);
-            _reset();
+        // Value of a "key:\tvalue" line of /proc/.../status
+        inline uint64_t _proc_status_field(const std::string& status, const char* key) {
+            size_t at = status.find(key);
+            return at == std::string::npos ? 0 : std::strtoull(status.c_str() + at + std::strlen(key) + 1, nullptr, 10);
         }
-    #endif
 
-    void Thread::set_name(const std::string& name) {
-        _ensure_joinable("set_name");
-        _set_name(handle_, name);
-    }
+        // Fills in what /proc/self/task/<tid> has, leaving cpu_time alone
+        // unless `run_time`, which takes it from the scheduler's count
+        inline void _proc_stats(pid_t tid, Thread::Stats& stats, bool counters, bool run_time = false) {
+            const std::string task = "/proc/self/task/" + std::to_string(tid) + "/";
+
+            // run_ns wait_ns timeslices
+            std::string schedstat = _read_proc(task + "schedstat");
+            if ( !schedstat.empty() ) {
+                char* end;
+                uint64_t run_ns = std::strtoull(schedstat.c_str(), &end, 10);
+                if ( run_time )
+                    stats.cpu_time = std::chrono::nanoseconds(run_ns);
+                stats.wait_time = std::chrono::nanoseconds(std::strtoull(end, nullptr, 10));
+            }
+            if ( !counters )
+                return;
+
+            // The name in field 2 may hold spaces, so count fields from after it
+            std::string stat = _read_proc(task + "stat");
+            size_t name_end = stat.rfind(')');
+            if ( name_end != std::string::npos ) {
+                static const long ticks = sysconf(_SC_CLK_TCK);
+                const char* field = stat.c_str() + name_end + 1;
+                for ( int i = 3; i <= 39 && *field; i++ ) {
+                    while ( *field == ' ' )
+                        field++;
+                    if ( i == 10 )
+                        stats.minor_faults = std::strtoull(field, nullptr, 10);
+                    else if ( i == 12 )
+                        stats.major_faults = std::strtoull(field, nullptr, 10);
+                    else if ( i == 14 )
+                        stats.user_time = std::chrono::nanoseconds(std::strtoull(field, nullptr, 10) * 1000000000 / ticks);
+                    else if ( i == 15 )
+                        stats.system_time = std::chrono::nanoseconds(std::strtoull(field, nullptr, 10) * 1000000000 / ticks);
+                    else if ( i == 39 )
+                        stats.cpu = std::strtoull(field, nullptr, 10);
+                    while ( *field && *field != ' ' )
+                        field++;
+                }
+            }
 
-    std::string Thread::get_name() const {
-        _ensure_joinable("get_name");
-        return _get_name(handle_);
-    }
+            std::string status = _read_proc(task + "status");
+            stats.voluntary_switches = _proc_status_field(status, "\nvoluntary_ctxt_switches:");
+            stats.involuntary_switches = _proc_status_field(status, "nonvoluntary_ctxt_switches:");
+        }
 
-    #if SIMPLY_WINDOWS
-        void Thread::set_wide_name(const std::wstring& wname) {
-            _ensure_joinable("set_wide_name");
-            _set_wide_name(handle_, wname);
+        inline std::chrono::nanoseconds _cpu_clock_time(clockid_t clock) {
+            struct timespec ts;
+            if ( clock_gettime(clock, &ts) )
+                throw std::system_error(errno, std::system_category());
+            return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
         }
 
-        std::wstring Thread::get_wide_name() const {
-            _ensure_joinable("get_wide_name");
-            return _get_wide_name(handle_);
+        inline Thread::Stats _stats_of(pthread_t thread, pid_t tid) {
+            clockid_t clock;
+            if ( int err = pthread_getcpuclockid(thread, &clock) )
+                throw std::system_error(err, std::system_category());
+            Thread::Stats stats {};
+            stats.cpu_time = _cpu_clock_time(clock);
+            _proc_stats(tid, stats, true);
+            return stats;
+        }
+
+        inline pid_t Thread::_tid() const noexcept {
+            if ( !standby_ )
+                return tid_;
+            // A new ThreadCache thread may not have got as far as recording it
+            uint32_t tid;
+            while ( !(tid = standby_->tid.load(std::memory_order_acquire)) )
+                _futex_wait(standby_->tid, 0);
+            return static_cast<pid_t>(tid);
         }
     #endif
 
+    inline Thread::Stats Thread::stats() const {
+        _ensure_joinable("stats");
+        #if SIMPLY_WINDOWS
+            return _stats_of(handle_);
+        #elif SIMPLY_LINUX
+            return _stats_of(handle_, _tid());
+        #endif
+    }
+
     #if SIMPLY_std20plus
         std::stop_source Thread::get_stop_source() noexcept {
             return stop_source_;
@@ -804,6 +4600,7 @@ namespace simply {
         }
 
         bool Thread::request_stop() noexcept {
+            SIMPLY_TRACE_INSTANT("request_stop");
             return stop_source_.request_stop();
         }
 
@@ -811,9 +4608,7 @@ namespace simply {
 
     #if SIMPLY_WINDOWS
         inline unsigned int Thread::hardware_concurrency() noexcept {
-            SYSTEM_INFO sysinfo {0};
-            GetSystemInfo(&sysinfo);
-            return sysinfo.dwNumberOfProcessors;
+            return GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
         }
     #elif SIMPLY_LINUX
         inline unsigned int Thread::hardware_concurrency() noexcept {
@@ -849,9 +4644,18 @@ namespace simply {
 
     void Thread::_reset() {
         handle_ = SIMPLY_NULL_THREAD;
+        standby_ = nullptr;
         #if SIMPLY_std20plus
             stop_source_ = std::stop_source();
         #endif
+        #if SIMPLY_LINUX
+            tid_ = 0;
+            // Only reached once joined (or detached), so the stack is free again
+            if ( stack_pool_ )
+                stack_pool_->_release(stack_);
+            stack_pool_ = nullptr;
+            stack_ = nullptr;
+        #endif
     }
 
     // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -859,7 +4663,10 @@ namespace simply {
     // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     #if SIMPLY_WINDOWS
         Thread::id this_thread::get_id() noexcept {
-            return Thread::id(GetCurrentThread());
+            _ThreadControl& control = _control_self();
+            if ( control.id == Thread::id() )
+                control.id = Thread::id(GetCurrentThread());
+            return control.id;
         }
 
         void this_thread::yield() noexcept {
@@ -877,7 +4684,10 @@ namespace simply {
 
     #elif SIMPLY_LINUX
         Thread::id this_thread::get_id() noexcept {
-            return Thread::id(pthread_self());
+            _ThreadControl& control = _control_self();
+            if ( control.id == Thread::id() )
+                control.id = Thread::id(pthread_self());
+            return control.id;
         }
 
         void this_thread::yield() noexcept {
@@ -890,41 +4700,117 @@ namespace simply {
                     std::make_error_code(std::errc::invalid_argument),
                     "this_thread::sleep: Too long a period to sleep for!"
                 );
-            
-            struct timespec duration;
-            duration.tv_nsec = (ms_sleep % 1000000) * 1000;
-            duration.tv_sec  = (ms_sleep / 1000);
-            
-            /// @todo - Make nanosleep more robust by checking err and return
-            nanosleep(&duration, nullptr);
+            _sleep_until_steady(std::chrono::steady_clock::now() + std::chrono::milliseconds(ms_sleep));
         }
 
     #endif
 
+    inline void this_thread::relax() noexcept {
+        #if SIMPLY_WAITPKG
+            if ( _cpu_has_waitpkg() )
+                return _cpu_tpause(_relax_cycles);
+        #endif
+        _cpu_pause();
+    }
+
     template <class Clock, class Duration>
     void this_thread::sleep_until(const std::chrono::time_point<Clock, Duration>& abs_time) {
-        this_thread::sleep_for(abs_time - Clock::now());
+        if constexpr ( std::is_same_v<Clock, std::chrono::steady_clock> ) {
+            _sleep_until_steady(std::chrono::ceil<std::chrono::steady_clock::duration>(abs_time));
+        }
+        #if SIMPLY_LINUX
+            else if constexpr ( std::is_same_v<Clock, std::chrono::system_clock> ) {
+                // Follows changes to the wall clock while asleep
+                _sleep_until(CLOCK_REALTIME, _to_timespec(abs_time.time_since_epoch()));
+            }
+        #endif
+        else {
+            for ( auto now = Clock::now(); now < abs_time; now = Clock::now() )
+                _sleep_until_steady(_steady_deadline(abs_time - now));
+        }
+    }
+
+    template <class Clock, class Duration>
+    void this_thread::sleep_until(const std::chrono::time_point<Clock, Duration>& abs_time, std::chrono::nanoseconds spin) {
+        if ( spin.count() < 0 )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "this_thread::sleep_until: Spin must not be negative!"
+            );
+        if ( abs_time - Clock::now() > spin )
+            this_thread::sleep_until(abs_time - spin);
+        while ( Clock::now() < abs_time )
+            _cpu_pause();
     }
 
     template <class Rep, class Period>
     void this_thread::sleep_for(const std::chrono::duration<Rep, Period>& rel_time) {
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(rel_time).count();
-        /// @todo - Change this to just repeat calls to sleep() until the time point is reached...
-        if ( ms < 0 || ms > std::numeric_limits<ms_type>::max() )
+        if ( rel_time < rel_time.zero() )
             throw std::system_error(
                 std::make_error_code(std::errc::invalid_argument),
-                "this_thread::sleep_for: Value was negative or too large!"
+                "this_thread::sleep_for: Value was negative!"
             );
-        sleep(static_cast<ms_type>(ms));
+        _sleep_until_steady(_steady_deadline(rel_time));
     }
 
-    #if SIMPLY_WINDOWS
-        std::string this_thread::get_name() {
-            return _get_name(GetCurrentThread());
+    template <class Rep, class Period>
+    void this_thread::sleep_for(const std::chrono::duration<Rep, Period>& rel_time, std::chrono::nanoseconds spin) {
+        if ( rel_time < rel_time.zero() )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "this_thread::sleep_for: Value was negative!"
+            );
+        this_thread::sleep_until(_steady_deadline(rel_time), spin);
+    }
+
+    #if SIMPLY_std20plus
+        template <class Clock, class Duration>
+        bool this_thread::sleep_until(const std::chrono::time_point<Clock, Duration>& abs_time, const std::stop_token& token) {
+            if constexpr ( std::is_same_v<Clock, std::chrono::steady_clock> ) {
+                return _sleep_until_steady(std::chrono::ceil<std::chrono::steady_clock::duration>(abs_time), token);
+            }
+            else {
+                for ( auto now = Clock::now(); now < abs_time; now = Clock::now() )
+                    if ( !_sleep_until_steady(_steady_deadline(abs_time - now), token) )
+                        return false;
+                return !token.stop_requested();
+            }
+        }
+
+        template <class Rep, class Period>
+        bool this_thread::sleep_for(const std::chrono::duration<Rep, Period>& rel_time, const std::stop_token& token) {
+            if ( rel_time < rel_time.zero() )
+                throw std::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "this_thread::sleep_for: Value was negative!"
+                );
+            return _sleep_until_steady(_steady_deadline(rel_time), token);
+        }
+
+    #endif
+
+    #if SIMPLY_std20plus
+        inline std::stop_token this_thread::get_stop_token() noexcept {
+            return _control_self().stop_token;
         }
+    #endif
+
+    inline std::string this_thread::get_name() {
+        _ThreadControl& control = _control_self();
+        control.refresh();
+        if ( !control.name )
+            #if SIMPLY_WINDOWS
+                control.name = _get_name(GetCurrentThread());
+            #elif SIMPLY_LINUX
+                control.name = _get_name(pthread_self());
+            #endif
+        return *control.name;
+    }
 
+    #if SIMPLY_WINDOWS
         void this_thread::set_name(const std::string& name) {
             _set_name(GetCurrentThread(), name);
+            _control_self().name = name;
         }
 
         std::wstring this_thread::get_wide_name() {
@@ -933,47 +4819,60 @@ namespace simply {
 
         void this_thread::set_wide_name(const std::wstring& wname) {
             _set_wide_name(GetCurrentThread(), wname);
+            _control_self().name = _from_wstring(wname);
         }
 
     #elif SIMPLY_LINUX
-        inline std::string this_thread::get_name() {
-            return _get_name(pthread_self());
-        }
-
         inline void this_thread::set_name(const std::string& name) {
             _set_name(pthread_self(), name);
+            _control_self().name = name;
         }
     #endif
 
+    inline void this_thread::set_affinity(const CpuSet& cpus) {
+        #if SIMPLY_WINDOWS
+            _set_affinity(GetCurrentThread(), cpus);
+        #elif SIMPLY_LINUX
+            _set_affinity(pthread_self(), cpus);
+        #endif
+        // Linux narrows it to the cpuset the thread may use, so read back what was set
+        _control_self().affinity.reset();
+    }
+
+    inline CpuSet this_thread::get_affinity() {
+        _ThreadControl& control = _control_self();
+        control.refresh();
+        if ( !control.affinity ) {
+            #if SIMPLY_WINDOWS
+                control.affinity = _get_affinity(GetCurrentThread());
+            #elif SIMPLY_LINUX
+                cpu_set_t set;
+                if ( sched_getaffinity(0, sizeof(set), &set) )
+                    throw std::system_error(errno, std::system_category());
+                control.affinity = _from_cpu_set(set);
+            #endif
+        }
+        return *control.affinity;
+    }
+
+    inline Arena* this_thread::arena() noexcept {
+        return _arena_self();
+    }
+
     #if SIMPLY_WINDOWS
+        inline void this_thread::set_priority(Thread::Priority priority) {
+            _set_priority(GetCurrentThread(), priority);
+            _ThreadControl& control = _control_self();
+            control.priority = priority;
+            control.qos.reset();
+        }
+
         inline Thread::Priority this_thread::get_priority() {
-            int p = GetThreadPriority(GetCurrentThread());
-            switch ( p ) {
-                case THREAD_PRIORITY_ERROR_RETURN:
-                    throw std::system_error(
-                        GetLastError(),
-                        std::system_category()
-                    );
-                case THREAD_PRIORITY_IDLE:
-                    return Thread::Priority::IDLE;
-                case THREAD_PRIORITY_LOWEST:
-                    return Thread::Priority::LOWEST;
-                case THREAD_PRIORITY_BELOW_NORMAL:
-                    return Thread::Priority::LOW;
-                case THREAD_PRIORITY_NORMAL:
-                    return Thread::Priority::NORMAL;
-                case THREAD_PRIORITY_ABOVE_NORMAL:
-                    return Thread::Priority::HIGH;
-                case THREAD_PRIORITY_HIGHEST:
-                    return Thread::Priority::HIGHEST;
-                case THREAD_PRIORITY_TIME_CRITICAL:
-                    return Thread::Priority::TIME_CRITICAL;
-                default:
-                    if ( p < 0 )
-                        return Thread::Priority::IDLE;
-                    else
-                        return Thread::Priority::TIME_CRITICAL;
-            }
+            _ThreadControl& control = _control_self();
+            control.refresh();
+            if ( !control.priority )
+                control.priority = _get_priority(GetCurrentThread());
+            return *control.priority;
         }
 
         // Suppressed for reason at declaration of this...
@@ -984,9 +4883,419 @@ namespace simply {
             //     return static_cast<size_t>(high - low);
             // }
     #elif SIMPLY_LINUX 
+        inline void this_thread::set_scheduling(Thread::Policy policy, int priority) {
+            _check_scheduling(policy, priority, "this_thread::set_scheduling");
+            _set_scheduling(pthread_self(), policy, priority);
+            _ThreadControl& control = _control_self();
+            control.scheduling.emplace(policy, priority);
+            control.qos.reset();
+        }
+
+        inline void this_thread::set_deadline(std::chrono::nanoseconds runtime, std::chrono::nanoseconds deadline, std::chrono::nanoseconds period) {
+            Thread::Deadline parameters {runtime, deadline, period};
+            _check_deadline(parameters, "this_thread::set_deadline");
+            if ( int err = _set_deadline(parameters) )
+                throw std::system_error(err, std::system_category());
+            _ThreadControl& control = _control_self();
+            control.scheduling.emplace(Thread::Policy::DEADLINE, 0);
+            control.qos.reset();
+        }
+
+        // Policy and priority, cached together as they are read together
+        inline const std::pair<Thread::Policy, int>& _scheduling_self() {
+            _ThreadControl& control = _control_self();
+            control.refresh();
+            if ( !control.scheduling ) {
+                int priority;
+                Thread::Policy policy = _get_policy(pthread_self(), &priority);
+                control.scheduling.emplace(policy, priority);
+            }
+            return *control.scheduling;
+        }
+
+        inline Thread::Policy this_thread::get_policy() {
+            return _scheduling_self().first;
+        }
+
+        inline int this_thread::get_priority() {
+            return _scheduling_self().second;
+        }
+
+        inline void this_thread::set_nice(int nice) {
+            _check_nice(nice, "this_thread::set_nice");
+            if ( int err = _set_nice(nice) )
+                throw std::system_error(err, std::system_category());
+        }
+
+        inline int this_thread::get_nice() {
+            // -1 is a valid nice value, so errors are only seen through errno
+            errno = 0;
+            int nice = getpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)));
+            if ( errno )
+                throw std::system_error(errno, std::system_category());
+            return nice;
+        }
+
+    #endif
+
+    inline void this_thread::set_qos(Thread::QoS qos) {
+        #if SIMPLY_WINDOWS
+            if ( DWORD err = _set_qos(GetCurrentThread(), qos) )
+                throw std::system_error(err, std::system_category());
+        #elif SIMPLY_LINUX
+            if ( int err = _set_qos(0, qos) )
+                throw std::system_error(err, std::system_category());
+        #endif
+        _ThreadControl& control = _control_self();
+        control.qos = qos;
+        // Into or out of BACKGROUND changes the priority/policy too
+        #if SIMPLY_WINDOWS
+            control.priority.reset();
+        #elif SIMPLY_LINUX
+            control.scheduling.reset();
+        #endif
+    }
+
+    inline Thread::QoS this_thread::get_qos() {
+        _ThreadControl& control = _control_self();
+        control.refresh();
+        if ( !control.qos ) {
+            #if SIMPLY_WINDOWS
+                control.qos = _get_qos(GetCurrentThread());
+            #elif SIMPLY_LINUX
+                control.qos = _get_qos(0);
+            #endif
+        }
+        return *control.qos;
+    }
+
+    #if SIMPLY_WINDOWS
+        inline Thread::Stats this_thread::stats() {
+            Thread::Stats stats = _stats_of(GetCurrentThread());
+            PROCESSOR_NUMBER processor;
+            GetCurrentProcessorNumberEx(&processor);
+            stats.cpu = processor.Group * 64 + processor.Number;
+            return stats;
+        }
+
+    #elif SIMPLY_LINUX
+        inline Thread::Stats this_thread::stats() {
+            Thread::Stats stats {};
+            stats.cpu_time = _cpu_clock_time(CLOCK_THREAD_CPUTIME_ID);
+
+            struct rusage usage;
+            if ( getrusage(RUSAGE_THREAD, &usage) )
+                throw std::system_error(errno, std::system_category());
+            stats.user_time = std::chrono::seconds(usage.ru_utime.tv_sec) + std::chrono::microseconds(usage.ru_utime.tv_usec);
+            stats.system_time = std::chrono::seconds(usage.ru_stime.tv_sec) + std::chrono::microseconds(usage.ru_stime.tv_usec);
+            stats.voluntary_switches = static_cast<uint64_t>(usage.ru_nvcsw);
+            stats.involuntary_switches = static_cast<uint64_t>(usage.ru_nivcsw);
+            stats.minor_faults = static_cast<uint64_t>(usage.ru_minflt);
+            stats.major_faults = static_cast<uint64_t>(usage.ru_majflt);
+
+            int cpu = sched_getcpu();
+            if ( cpu >= 0 )
+                stats.cpu = static_cast<size_t>(cpu);
+            _proc_stats(static_cast<pid_t>(syscall(SYS_gettid)), stats, false);
+            return stats;
+        }
+    #endif
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ ThreadRegistry
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline void ThreadRegistry::enable(bool enabled) noexcept {
+        _registry_enabled().store(enabled, std::memory_order_relaxed);
+    }
+
+    inline bool ThreadRegistry::enabled() noexcept {
+        return _registry_enabled().load(std::memory_order_relaxed);
+    }
+
+    inline size_t ThreadRegistry::size() noexcept {
+        size_t count = 0;
+        char name[_RegistrySlot::name_words * 8];
+        for ( _RegistrySlot* slot = _registry_head().load(std::memory_order_acquire); slot; slot = slot->next )
+            if ( slot->read(nullptr, name) == _RegistrySlot::LIVE )
+                count++;
+        return count;
+    }
+
+    // Stats of a thread by its OS id, zeroes if it has just exited
+    inline Thread::Stats _stats_of_os_id(uint64_t os_id) noexcept {
+        Thread::Stats stats {};
+        #if SIMPLY_WINDOWS
+            if ( HANDLE thread = OpenThread(THREAD_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(os_id)) ) {
+                try { stats = _stats_of(thread); } catch ( ... ) {}
+                CloseHandle(thread);
+            }
+        #elif SIMPLY_LINUX
+            // There is no pthread_t to take the CPU clock of, so the scheduler's count stands in for it
+            try {
+                _proc_stats(static_cast<pid_t>(os_id), stats, true, true);
+            }
+            catch ( ... ) {}
+        #endif
+        return stats;
+    }
+
+    inline Thread::Stats ThreadInfo::sample_stats() const noexcept {
+        return _stats_of_os_id(os_id);
+    }
+
+    inline Thread::Attributes _attributes_of(const _RegistryAttributes& copy) {
+        using Has = _RegistryAttributes::Has;
+        Thread::Attributes attributes;
+        attributes.stack_size(copy.stack_size).guard_size(copy.guard_size).arena(copy.arena).prefault_stack(copy.prefault_stack);
+        if ( copy.has & Has::AFFINITY ) {
+            CpuSet cpus;
+            for ( size_t cpu = 0; cpu < CpuSet::max_cpus; cpu++ )
+                if ( (copy.affinity[cpu / 64] >> (cpu % 64)) & 1 )
+                    cpus.set(cpu);
+            attributes.affinity(cpus);
+        }
+        if ( copy.has & Has::QOS )
+            attributes.qos(static_cast<Thread::QoS>(copy.qos));
+        #if SIMPLY_WINDOWS
+            if ( copy.has & Has::PRIORITY )
+                attributes.priority(static_cast<Thread::Priority>(copy.priority));
+        #elif SIMPLY_LINUX
+            if ( copy.has & Has::DEADLINE )
+                attributes.deadline(std::chrono::nanoseconds(copy.runtime), std::chrono::nanoseconds(copy.deadline), std::chrono::nanoseconds(copy.period));
+            else if ( copy.has & Has::POLICY )
+                attributes.scheduling(static_cast<Thread::Policy>(copy.policy), copy.priority);
+            if ( copy.has & Has::NICE )
+                attributes.nice(copy.nice);
+        #endif
+        attributes.name(copy.name);
+        return attributes;
+    }
+
+    inline std::vector<ThreadInfo> ThreadRegistry::snapshot(bool with_stats) {
+        std::vector<ThreadInfo> threads;
+        char name[_RegistrySlot::name_words * 8];
+        _RegistryAttributes attributes;
+        for ( _RegistrySlot* slot = _registry_head().load(std::memory_order_acquire); slot; slot = slot->next ) {
+            ThreadInfo info {};
+            if ( slot->read(&info, name, std::numeric_limits<size_t>::max(), &attributes) != _RegistrySlot::LIVE )
+                continue;
+            info.name = name;
+            info.attributes = _attributes_of(attributes);
+            if ( with_stats )
+                info.stats = _stats_of_os_id(info.os_id);
+            threads.push_back(std::move(info));
+        }
+        return threads;
+    }
+
+    // Async-signal-safe formatting for dump
+    inline char* _format_uint(char* out, uint64_t value) noexcept {
+        char digits[20];
+        int n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while ( value );
+        while ( n )
+            *out++ = digits[--n];
+        return out;
+    }
+
+    inline void ThreadRegistry::dump(int fd) noexcept {
+        char name[_RegistrySlot::name_words * 8];
+        char line[160];
+        for ( _RegistrySlot* slot = _registry_head().load(std::memory_order_acquire); slot; slot = slot->next ) {
+            ThreadInfo info;
+            _RegistrySlot::Read read = slot->read(&info, name, _RegistrySlot::signal_tries);
+            if ( read == _RegistrySlot::FREE )
+                continue;
+
+            char* out = line;
+            if ( read == _RegistrySlot::BUSY ) {
+                // "? busy\n" - mid-update, likely by the thread the signal interrupted
+                const char busy[] = "? busy\n";
+                std::memcpy(out, busy, sizeof(busy) - 1);
+                out += sizeof(busy) - 1;
+            }
+            else {
+                auto started = std::chrono::duration_cast<std::chrono::milliseconds>(info.started.time_since_epoch()).count();
+
+                // "<os_id> <name> started=<ms since epoch>\n"
+                out = _format_uint(out, info.os_id);
+                *out++ = ' ';
+                for ( const char* c = name; *c; c++ )
+                    *out++ = *c;
+                const char started_label[] = " started=";
+                std::memcpy(out, started_label, sizeof(started_label) - 1);
+                out = _format_uint(out + sizeof(started_label) - 1, static_cast<uint64_t>(started));
+                *out++ = '\n';
+            }
+
+            #if SIMPLY_WINDOWS
+                _write(fd, line, static_cast<unsigned int>(out - line));
+            #elif SIMPLY_LINUX
+                if ( ::write(fd, line, static_cast<size_t>(out - line)) < 0 )
+                    return;
+            #endif
+        }
+    }
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Memory locking
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    #if SIMPLY_WINDOWS
+        // Every committed region VirtualLock may take
+        inline std::vector<MEMORY_BASIC_INFORMATION> _committed_regions() {
+            std::vector<MEMORY_BASIC_INFORMATION> regions;
+            MEMORY_BASIC_INFORMATION info;
+            for ( char* at = nullptr; VirtualQuery(at, &info, sizeof(info)); at = static_cast<char*>(info.BaseAddress) + info.RegionSize )
+                if ( info.State == MEM_COMMIT && !(info.Protect & (PAGE_GUARD | PAGE_NOACCESS)) )
+                    regions.push_back(info);
+            return regions;
+        }
+
+        inline void lock_memory(bool) {
+            std::vector<MEMORY_BASIC_INFORMATION> regions = _committed_regions();
+            SIZE_T total = 0;
+            for ( const MEMORY_BASIC_INFORMATION& region : regions )
+                total += region.RegionSize;
+
+            // Locked pages count against the minimum working set, so make room for them all
+            HANDLE process = GetCurrentProcess();
+            SIZE_T min_size, max_size;
+            if ( !GetProcessWorkingSetSize(process, &min_size, &max_size) )
+                throw std::system_error(GetLastError(), std::system_category());
+            if ( !SetProcessWorkingSetSize(process, min_size + total, max_size + total) )
+                throw std::system_error(GetLastError(), std::system_category());
+
+            for ( const MEMORY_BASIC_INFORMATION& region : regions )
+                if ( !VirtualLock(region.BaseAddress, region.RegionSize) )
+                    throw std::system_error(GetLastError(), std::system_category());
+        }
+
+        inline void unlock_memory() noexcept {
+            try {
+                for ( const MEMORY_BASIC_INFORMATION& region : _committed_regions() )
+                    VirtualUnlock(region.BaseAddress, region.RegionSize);
+            }
+            catch ( ... ) {}
+        }
 
+    #elif SIMPLY_LINUX
+        inline void lock_memory(bool future) {
+            if ( mlockall(MCL_CURRENT | (future ? MCL_FUTURE : 0)) )
+                throw std::system_error(errno, std::system_category());
+        }
 
+        inline void unlock_memory() noexcept {
+            munlockall();
+        }
     #endif
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Trace
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline void _trace_write_string(std::ostream& out, const std::string& value) {
+        out << '"';
+        for ( char c : value ) {
+            if ( c == '"' || c == '\\' )
+                out << '\\' << c;
+            else if ( static_cast<unsigned char>(c) < 0x20 )
+                out << ' ';
+            else
+                out << c;
+        }
+        out << '"';
+    }
+
+    // Microseconds with 3 decimals, as Chrome trace timestamps are
+    inline void _trace_write_time(std::ostream& out, int64_t ns) {
+        char fraction[4] = {
+            char('0' + ns / 100 % 10), char('0' + ns / 10 % 10), char('0' + ns % 10), 0
+        };
+        out << ns / 1000 << '.' << fraction;
+    }
+
+    inline void Trace::write(std::ostream& out) {
+        #if SIMPLY_WINDOWS
+            uint64_t pid = GetCurrentProcessId();
+        #elif SIMPLY_LINUX
+            uint64_t pid = static_cast<uint64_t>(getpid());
+        #endif
+
+        // Ticks to nanoseconds, from how far both have moved since the epoch
+        const _TraceEpoch& epoch = _trace_epoch();
+        _TraceEpoch now = _trace_now();
+        double ns_per_tick = now.ticks > epoch.ticks
+            ? double(now.ns - epoch.ns) / double(now.ticks - epoch.ticks)
+            : 1.0;
+
+        struct Copied {
+            uint64_t time;
+            const char* name;
+            char phase;
+        };
+        std::vector<Copied> events;
+        bool first = true;
+        auto separator = [&out, &first](){
+            if ( !first )
+                out << ",\n";
+            first = false;
+        };
+
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        for ( _TraceBuffer* buffer = _trace_head().load(std::memory_order_acquire); buffer; buffer = buffer->next ) {
+            uint64_t head = buffer->head.load(std::memory_order_acquire);
+            uint64_t begin = std::max(buffer->floor.load(std::memory_order_relaxed), head > buffer_events ? head - buffer_events : 0);
+            events.clear();
+            for ( uint64_t i = begin; i < head; i++ ) {
+                const _TraceEvent& event = buffer->events[i % buffer_events];
+                events.push_back(Copied{
+                    event.time.load(std::memory_order_relaxed),
+                    event.name.load(std::memory_order_relaxed),
+                    event.phase.load(std::memory_order_relaxed)
+                });
+            }
+            // Any event the owner has started overwriting since is dropped
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t after = buffer->head.load(std::memory_order_relaxed);
+            uint64_t valid = after >= buffer_events ? after - buffer_events + 1 : 0;
+            if ( begin < valid )
+                events.erase(events.begin(), events.begin() + static_cast<ptrdiff_t>(std::min<uint64_t>(valid - begin, events.size())));
+            if ( events.empty() )
+                continue;
+
+            uint64_t tid = buffer->os_id.load(std::memory_order_relaxed);
+            std::string name;
+            {
+                std::lock_guard<std::mutex> lock(buffer->name_mutex);
+                name = buffer->name;
+            }
+            separator();
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << tid << ",\"args\":{\"name\":";
+            _trace_write_string(out, name.empty() ? "thread " + std::to_string(tid) : name);
+            out << "}}";
+
+            for ( const Copied& event : events ) {
+                int64_t ns = epoch.ns + static_cast<int64_t>(double(int64_t(event.time - epoch.ticks)) * ns_per_tick);
+                separator();
+                out << "{\"name\":";
+                _trace_write_string(out, event.name ? event.name : "");
+                out << ",\"cat\":\"simply\",\"ph\":\"" << event.phase << "\",\"ts\":";
+                _trace_write_time(out, ns);
+                out << ",\"pid\":" << pid << ",\"tid\":" << tid;
+                if ( event.phase == 'i' )
+                    out << ",\"s\":\"t\"";
+                out << "}";
+            }
+        }
+        out << "\n]}\n";
+    }
+
+    inline void Trace::clear() noexcept {
+        for ( _TraceBuffer* buffer = _trace_head().load(std::memory_order_acquire); buffer; buffer = buffer->next )
+            buffer->floor.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
 }
 
 #endif // SIMPLY_THREADING_H_
\ No newline at end of file
@@ -0,0 +1,570 @@
+/**
+ * @file timer_service.h
+ * @brief simply-threading: Delayed and recurring callbacks on one `simply::Thread`, kept in a hierarchical timer wheel
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_TIMER_SERVICE_H_
+#define SIMPLY_TIMER_SERVICE_H_
+
+#include "sync.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace simply {
+    // =================================================================
+    // >> TimerService
+    // =================================================================
+    // The wheel has 11 levels of 64 slots, so that every 64-bit tick has
+    // a place without any overflow list. A timer sits in the level of the
+    // highest base-64 digit in which its tick differs from the current one.
+    constexpr unsigned _timer_bits = 6;
+    constexpr unsigned _timer_slots = 1u << _timer_bits;
+    constexpr unsigned _timer_levels = 11;
+    constexpr uint16_t _timer_due = _timer_levels * _timer_slots;  // List of timers already due
+    constexpr uint16_t _timer_free = _timer_due + 1;               // Not armed
+    constexpr uint32_t _timer_nil = std::numeric_limits<uint32_t>::max();
+    constexpr uint32_t _timer_chunk = 4096;                        // Nodes per allocation
+
+    #if SIMPLY_WINDOWS
+        // WaitOnAddress times out on the system tick, so the last stretch
+        // before a deadline is slept on the high-resolution timer instead -
+        // in slices, so that an earlier timer still gets its wake-up
+        constexpr std::chrono::milliseconds _timer_approach{16};
+        constexpr std::chrono::milliseconds _timer_approach_slice{1};
+    #endif
+
+    ///   _TimerNode {internal}
+    /// @brief One armed timer, linked into a wheel slot by index
+    struct _TimerNode {
+        std::function<void()> callback;
+        int64_t due = 0;                // ns after the service's origin
+        int64_t period = 0;             // ns, 0 if not recurring
+        uint64_t tick = 0;              // `due` rounded up to whole ticks
+        uint32_t prev = _timer_nil;
+        uint32_t next = _timer_nil;
+        uint32_t generation = 1;        // Bumped on every free, so stale ids miss
+        uint16_t slot = _timer_free;    // level * 64 + slot, or _timer_due/_timer_free
+    };
+
+    ///   TimerService
+    /// @brief One `simply::Thread` running callbacks at given times, or at a fixed rate
+    ///
+    /// Timers live in a hierarchical timer wheel, so arming and cancelling
+    /// are O(1) however many are armed, and each timer cascades down at most
+    /// once per level before it fires. Ticks are `resolution` long, and a
+    /// callback never runs before its time - at most a tick plus the wake-up
+    /// latency after it. The thread sleeps on an absolute steady_clock
+    /// deadline until the next tick with work, woken early only by a timer
+    /// due before it. For Linux that is one futex wait, timed as precisely
+    /// as this_thread::sleep_until. WaitOnAddress only times out on the
+    /// system tick, so for Windows the last 16ms are slept on
+    /// this_thread's high-resolution timer, in 1ms slices.
+    ///
+    /// Callbacks run on the service thread, or with a ThreadPool, are handed
+    /// to it in batches - so inline callbacks must be short. As for `Thread`,
+    /// an exception escaping a callback terminates the program.
+    class TimerService {
+    public:
+        ///   id_type
+        /// @brief Names an armed timer for `cancel` - never 0, and not reused by later timers
+        using id_type = uint64_t;
+
+        ///   default_resolution
+        static constexpr std::chrono::nanoseconds default_resolution = std::chrono::microseconds(100);
+
+        /* === Constructors/Destructor === ========================== */
+        ///   Constructor
+        /// @brief Start the service thread named `name`, running callbacks itself
+        /// @throws
+        ///  - system_error(invalid_argument) if `resolution` is not positive
+        explicit TimerService(const std::string& name = "timers", std::chrono::nanoseconds resolution = default_resolution);
+
+        ///   Constructor {pool}
+        /// @brief Start the service thread named `name`, running callbacks on `pool`
+        ///
+        /// `pool` must outlive this
+        /// @throws
+        ///  - system_error(invalid_argument) if `resolution` is not positive
+        explicit TimerService(ThreadPool& pool, const std::string& name = "timers", std::chrono::nanoseconds resolution = default_resolution);
+
+        ///   Destructor {blocking}
+        /// @brief Stops and joins the thread - timers still armed never run
+        ~TimerService();
+
+        ///   Single-Ownership
+        TimerService(const TimerService&) = delete;
+        TimerService& operator=(const TimerService&) = delete;
+
+        /* === Control/Operations === =============================== */
+        ///   schedule_at
+        /// @brief Run `f()` once at `abs_time`, or as soon as possible if it has passed
+        template <class F>
+        id_type schedule_at(std::chrono::steady_clock::time_point abs_time, F&& f);
+
+        ///   schedule_after
+        /// @brief Run `f()` once after `delay`
+        /// @throws
+        ///  - system_error(invalid_argument) if `delay` is negative
+        template <class F>
+        id_type schedule_after(std::chrono::nanoseconds delay, F&& f);
+
+        ///   schedule_every
+        /// @brief Run `f()` every `period`, starting one period from now, until cancelled
+        ///
+        /// Deadlines follow each other by exactly `period`. If the callbacks
+        /// fall behind by more than a period, the missed runs are skipped.
+        /// @throws
+        ///  - system_error(invalid_argument) if `period` is not positive
+        template <class F>
+        id_type schedule_every(std::chrono::nanoseconds period, F&& f);
+
+        ///   cancel
+        /// @brief Disarm timer `id`, so it won't run (again)
+        ///
+        /// A run already handed to the pool may still be going
+        /// @returns `false` if `id` had already fired, or was cancelled
+        bool cancel(id_type id);
+
+        /* === Observers === ======================================== */
+        ///   size
+        /// @brief Number of timers armed
+        size_t size() const;
+
+        ///   resolution
+        std::chrono::nanoseconds resolution() const noexcept;
+
+        ///   thread
+        /// @brief The service thread
+        const Thread& thread() const noexcept;
+
+    private:
+        using _Batch = std::vector<std::function<void()>>;
+
+        TimerService(ThreadPool* pool, const std::string& name, std::chrono::nanoseconds resolution);
+
+        id_type _arm(int64_t due, int64_t period, std::function<void()> callback);
+
+        void _run();
+
+        void _dispatch(_Batch& batch);
+
+        _TimerNode& _node(uint32_t index) noexcept;
+
+        uint32_t _alloc();
+
+        void _free(uint32_t index) noexcept;
+
+        void _link(uint32_t index) noexcept;
+
+        void _unlink(uint32_t index) noexcept;
+
+        uint32_t _take(uint16_t slot) noexcept;
+
+        void _fire(uint32_t index, _Batch& batch);
+
+        void _advance(uint64_t target, _Batch& batch);
+
+        uint64_t _next_event() const noexcept;
+
+        int64_t _due_of(std::chrono::steady_clock::time_point abs_time) const noexcept;
+
+        uint64_t _tick_of(int64_t due) const noexcept;
+
+        mutable AdaptiveMutex mutex_;
+        std::vector<std::unique_ptr<_TimerNode[]>> chunks_;
+        uint32_t allocated_ = 0;
+        uint32_t free_ = _timer_nil;
+        uint32_t heads_[_timer_due + 1];
+        uint64_t occupied_[_timer_levels] = {};     // One bit per non-empty slot
+        uint64_t now_ = 0;                          // Every tick up to this has fired
+        uint64_t planned_ = std::numeric_limits<uint64_t>::max(); // Tick the thread sleeps until
+        size_t size_ = 0;
+        bool stopping_ = false;
+
+        std::atomic<uint32_t> wake_{0};             // Bumped to wake the thread early
+        ThreadPool* pool_;
+        std::chrono::steady_clock::time_point origin_;
+        int64_t resolution_;
+        Thread thread_;
+    };
+}
+
+// =====================================================================
+// >> Implementations
+// =====================================================================
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Wheel
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline unsigned _timer_lowest_bit(uint64_t bits) noexcept {
+        #if SIMPLY_WINDOWS
+            unsigned long index;
+            _BitScanForward64(&index, bits);
+            return static_cast<unsigned>(index);
+        #else
+            return static_cast<unsigned>(__builtin_ctzll(bits));
+        #endif
+    }
+
+    inline unsigned _timer_digit(uint64_t tick, unsigned level) noexcept {
+        return static_cast<unsigned>(tick >> (level * _timer_bits)) & (_timer_slots - 1);
+    }
+
+    inline _TimerNode& TimerService::_node(uint32_t index) noexcept {
+        return chunks_[index / _timer_chunk][index % _timer_chunk];
+    }
+
+    inline uint32_t TimerService::_alloc() {
+        if ( free_ != _timer_nil ) {
+            uint32_t index = free_;
+            free_ = _node(index).next;
+            return index;
+        }
+        if ( allocated_ == _timer_nil )
+            throw std::system_error(
+                std::make_error_code(std::errc::resource_unavailable_try_again),
+                "TimerService: Too many timers armed!"
+            );
+        if ( allocated_ % _timer_chunk == 0 )
+            chunks_.emplace_back(new _TimerNode[_timer_chunk]);
+        return allocated_++;
+    }
+
+    inline void TimerService::_free(uint32_t index) noexcept {
+        _TimerNode& node = _node(index);
+        node.slot = _timer_free;
+        if ( ++node.generation == 0 )
+            node.generation = 1;
+        node.next = free_;
+        free_ = index;
+    }
+
+    inline void TimerService::_link(uint32_t index) noexcept {
+        _TimerNode& node = _node(index);
+        if ( node.tick <= now_ ) {
+            node.slot = _timer_due;
+        }
+        else {
+            unsigned level = 0;
+            for ( uint64_t differ = (node.tick ^ now_) >> _timer_bits; differ; differ >>= _timer_bits )
+                level++;
+            unsigned digit = _timer_digit(node.tick, level);
+            node.slot = static_cast<uint16_t>(level * _timer_slots + digit);
+            occupied_[level] |= uint64_t(1) << digit;
+        }
+        node.prev = _timer_nil;
+        node.next = heads_[node.slot];
+        if ( node.next != _timer_nil )
+            _node(node.next).prev = index;
+        heads_[node.slot] = index;
+    }
+
+    inline void TimerService::_unlink(uint32_t index) noexcept {
+        _TimerNode& node = _node(index);
+        if ( node.prev != _timer_nil )
+            _node(node.prev).next = node.next;
+        else
+            heads_[node.slot] = node.next;
+        if ( node.next != _timer_nil )
+            _node(node.next).prev = node.prev;
+        if ( heads_[node.slot] == _timer_nil && node.slot < _timer_due )
+            occupied_[node.slot / _timer_slots] &= ~(uint64_t(1) << (node.slot % _timer_slots));
+    }
+
+    // Empties `slot`, returning its list
+    inline uint32_t TimerService::_take(uint16_t slot) noexcept {
+        uint32_t head = heads_[slot];
+        heads_[slot] = _timer_nil;
+        if ( slot < _timer_due )
+            occupied_[slot / _timer_slots] &= ~(uint64_t(1) << (slot % _timer_slots));
+        return head;
+    }
+
+    // Hands an unlinked timer's callback to `batch`, re-arming it if recurring
+    inline void TimerService::_fire(uint32_t index, _Batch& batch) {
+        _TimerNode& node = _node(index);
+        if ( !node.period ) {
+            batch.push_back(std::move(node.callback));
+            node.callback = nullptr;
+            _free(index);
+            size_--;
+            return;
+        }
+        batch.push_back(node.callback);
+        constexpr int64_t never = std::numeric_limits<int64_t>::max();
+        if ( node.due > never - node.period ) {
+            node.due = never;
+        }
+        else {
+            node.due += node.period;
+            // Onto the first deadline still ahead, in phase with the old ones
+            int64_t now = static_cast<int64_t>(now_) * resolution_;
+            if ( node.due <= now )
+                node.due += ((now - node.due) / node.period + 1) * node.period;
+        }
+        node.tick = _tick_of(node.due);
+        _link(index);
+    }
+
+    // Tick at which the wheel next has work - firing a slot, or cascading one
+    // down. Slots of a lower level always come due before those above it.
+    inline uint64_t TimerService::_next_event() const noexcept {
+        if ( heads_[_timer_due] != _timer_nil )
+            return now_;
+        for ( unsigned level = 0; level < _timer_levels; level++ ) {
+            unsigned digit = _timer_digit(now_, level);
+            uint64_t later = digit + 1 < _timer_slots ? occupied_[level] & (~uint64_t(0) << (digit + 1)) : 0;
+            if ( !later )
+                continue;
+            unsigned shift = (level + 1) * _timer_bits;
+            uint64_t base = shift < 64 ? (now_ >> shift) << shift : 0;
+            return base | (uint64_t(_timer_lowest_bit(later)) << (level * _timer_bits));
+        }
+        return std::numeric_limits<uint64_t>::max();
+    }
+
+    // Moves `now_` up to `target`, collecting every callback due on the way
+    inline void TimerService::_advance(uint64_t target, _Batch& batch) {
+        for ( ;; ) {
+            for ( uint32_t index = _take(_timer_due); index != _timer_nil; ) {
+                uint32_t next = _node(index).next;
+                _fire(index, batch);
+                index = next;
+            }
+            uint64_t event = _next_event();
+            if ( event > target ) {
+                now_ = std::max(now_, target);
+                return;
+            }
+            now_ = event;
+            // Higher levels first, as their timers may cascade into lower ones
+            for ( unsigned level = _timer_levels - 1; level > 0; level-- ) {
+                unsigned digit = _timer_digit(now_, level);
+                if ( !(occupied_[level] & (uint64_t(1) << digit)) )
+                    continue;
+                for ( uint32_t index = _take(static_cast<uint16_t>(level * _timer_slots + digit)); index != _timer_nil; ) {
+                    uint32_t next = _node(index).next;
+                    _link(index);
+                    index = next;
+                }
+            }
+            for ( uint32_t index = _take(static_cast<uint16_t>(_timer_digit(now_, 0))); index != _timer_nil; ) {
+                uint32_t next = _node(index).next;
+                _fire(index, batch);
+                index = next;
+            }
+        }
+    }
+
+    inline int64_t TimerService::_due_of(std::chrono::steady_clock::time_point abs_time) const noexcept {
+        if ( abs_time <= origin_ )
+            return 0;
+        auto since = abs_time - origin_;
+        if ( since >= std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds::max()) )
+            return std::numeric_limits<int64_t>::max();
+        return std::chrono::ceil<std::chrono::nanoseconds>(since).count();
+    }
+
+    // Rounded up, so that no timer fires early
+    inline uint64_t TimerService::_tick_of(int64_t due) const noexcept {
+        return static_cast<uint64_t>(due / resolution_ + (due % resolution_ != 0));
+    }
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ TimerService
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline TimerService::TimerService(const std::string& name, std::chrono::nanoseconds resolution):
+        TimerService(nullptr, name, resolution)
+    {}
+
+    inline TimerService::TimerService(ThreadPool& pool, const std::string& name, std::chrono::nanoseconds resolution):
+        TimerService(&pool, name, resolution)
+    {}
+
+    inline TimerService::TimerService(ThreadPool* pool, const std::string& name, std::chrono::nanoseconds resolution):
+        pool_(pool),
+        origin_(std::chrono::steady_clock::now()),
+        resolution_(resolution.count())
+    {
+        if ( resolution.count() <= 0 )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "TimerService: Resolution must be positive!"
+            );
+        std::fill(std::begin(heads_), std::end(heads_), _timer_nil);
+        thread_ = Thread(Thread::Attributes().name(name), [this](){ _run(); });
+    }
+
+    inline TimerService::~TimerService() {
+        {
+            std::lock_guard<AdaptiveMutex> lock(mutex_);
+            stopping_ = true;
+            wake_.fetch_add(1, std::memory_order_release);
+        }
+        _futex_wake_all(wake_);
+        thread_.join();
+    }
+
+    template <class F>
+    TimerService::id_type TimerService::schedule_at(std::chrono::steady_clock::time_point abs_time, F&& f) {
+        static_assert(std::is_invocable_v<std::decay_t<F>&>, "TimerService callback is malformed...");
+        return _arm(_due_of(abs_time), 0, std::function<void()>(std::forward<F>(f)));
+    }
+
+    template <class F>
+    TimerService::id_type TimerService::schedule_after(std::chrono::nanoseconds delay, F&& f) {
+        if ( delay.count() < 0 )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "TimerService::schedule_after: Delay was negative!"
+            );
+        return schedule_at(_steady_deadline(delay), std::forward<F>(f));
+    }
+
+    template <class F>
+    TimerService::id_type TimerService::schedule_every(std::chrono::nanoseconds period, F&& f) {
+        static_assert(std::is_invocable_v<std::decay_t<F>&>, "TimerService callback is malformed...");
+        if ( period.count() <= 0 )
+            throw std::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "TimerService::schedule_every: Period must be positive!"
+            );
+        // Shared by the copies handed out on each run
+        auto shared = std::make_shared<std::decay_t<F>>(std::forward<F>(f));
+        return _arm(_due_of(_steady_deadline(period)), period.count(), [shared](){ (*shared)(); });
+    }
+
+    inline TimerService::id_type TimerService::_arm(int64_t due, int64_t period, std::function<void()> callback) {
+        bool wake = false;
+        id_type id;
+        {
+            std::lock_guard<AdaptiveMutex> lock(mutex_);
+            uint32_t index = _alloc();
+            _TimerNode& node = _node(index);
+            node.callback = std::move(callback);
+            node.due = due;
+            node.period = period;
+            node.tick = _tick_of(due);
+            _link(index);
+            size_++;
+            id = (static_cast<id_type>(node.generation) << 32) | index;
+            // Only a timer due before the thread's planned wake-up needs it early
+            uint64_t at = std::max(node.tick, now_);
+            if ( at < planned_ ) {
+                planned_ = at;
+                wake_.fetch_add(1, std::memory_order_release);
+                wake = true;
+            }
+        }
+        if ( wake )
+            _futex_wake_one(wake_);
+        return id;
+    }
+
+    inline bool TimerService::cancel(id_type id) {
+        uint32_t index = static_cast<uint32_t>(id);
+        std::function<void()> callback; // Destroyed outside the lock
+        {
+            std::lock_guard<AdaptiveMutex> lock(mutex_);
+            if ( index >= allocated_ )
+                return false;
+            _TimerNode& node = _node(index);
+            if ( node.generation != static_cast<uint32_t>(id >> 32) || node.slot == _timer_free )
+                return false;
+            _unlink(index);
+            callback = std::move(node.callback);
+            node.callback = nullptr;
+            _free(index);
+            size_--;
+        }
+        return true;
+    }
+
+    inline void TimerService::_run() {
+        _Batch batch;
+        std::unique_lock<AdaptiveMutex> lock(mutex_);
+        while ( !stopping_ ) {
+            int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin_).count();
+            _advance(static_cast<uint64_t>(elapsed / resolution_), batch);
+            uint64_t next = _next_event();
+            planned_ = next;
+            uint32_t seen = wake_.load(std::memory_order_acquire);
+            lock.unlock();
+
+            _dispatch(batch);
+            if ( next > static_cast<uint64_t>(std::numeric_limits<int64_t>::max() / resolution_) ) {
+                _futex_wait(wake_, seen);
+            }
+            else {
+                auto deadline = origin_ + std::chrono::nanoseconds(static_cast<int64_t>(next) * resolution_);
+                #if SIMPLY_WINDOWS
+                    if ( !_futex_wait_until(wake_, seen, deadline - _timer_approach) )
+                        for ( auto now = std::chrono::steady_clock::now(); now < deadline && wake_.load(std::memory_order_acquire) == seen; now = std::chrono::steady_clock::now() )
+                            _sleep_until_steady(std::min<std::chrono::steady_clock::time_point>(deadline, now + _timer_approach_slice));
+                #else
+                    // FUTEX_WAIT_BITSET takes the absolute deadline, on the same hrtimer as clock_nanosleep
+                    _futex_wait_until(wake_, seen, deadline);
+                #endif
+            }
+            lock.lock();
+        }
+    }
+
+    // Runs the callbacks here, or splits them over the pool in a few tasks
+    inline void TimerService::_dispatch(_Batch& batch) {
+        if ( batch.empty() )
+            return;
+        if ( !pool_ ) {
+            for ( auto& callback : batch )
+                callback();
+            batch.clear();
+            return;
+        }
+        constexpr size_t min_per_task = 64;
+        size_t tasks = std::min(pool_->size(), (batch.size() + min_per_task - 1) / min_per_task);
+        for ( size_t t = 0, begin = 0; t < tasks; t++ ) {
+            size_t end = batch.size() * (t + 1) / tasks;
+            _Batch part(std::make_move_iterator(batch.begin() + begin), std::make_move_iterator(batch.begin() + end));
+            pool_->submit([part = std::move(part)]() mutable {
+                for ( auto& callback : part )
+                    callback();
+            });
+            begin = end;
+        }
+        batch.clear();
+    }
+
+    inline size_t TimerService::size() const {
+        std::lock_guard<AdaptiveMutex> lock(mutex_);
+        return size_;
+    }
+
+    inline std::chrono::nanoseconds TimerService::resolution() const noexcept {
+        return std::chrono::nanoseconds(resolution_);
+    }
+
+    inline const Thread& TimerService::thread() const noexcept {
+        return thread_;
+    }
+}
+
+#endif // SIMPLY_TIMER_SERVICE_H_
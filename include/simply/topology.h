@@ -0,0 +1,365 @@
+/**
+ * @file topology.h
+ * @brief simply-threading: CPU topology - physical cores, SMT siblings, shared caches and NUMA nodes
+ *
+ * @author Ferdinand Oliver M Tonby-Strandborg
+ * @date 2026-10-14
+ * @version 0.0.0-alpha
+ *
+ * @copyright Copyright (c) 2025 Ferdinand T-S. Licensed under the MIT license.
+ */
+#ifndef SIMPLY_TOPOLOGY_H_
+#define SIMPLY_TOPOLOGY_H_
+
+#include "threading.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if SIMPLY_LINUX
+    #include <fstream>
+#endif
+
+namespace simply {
+    // =================================================================
+    // >> Topology
+    // =================================================================
+    ///   Topology
+    /// @brief Layout of the logical CPUs of this machine
+    ///
+    /// CPU indices follow CpuSet, so any of the sets here can be passed
+    /// straight to `set_affinity`. Indices into `cores`, `caches` and
+    /// `nodes` are only meaningful within one Topology.
+    struct Topology {
+        ///   Cpu
+        /// @brief A logical CPU (hardware thread)
+        struct Cpu {
+            size_t id;       // CpuSet index
+            size_t core;     // Index into cores
+            size_t package;  // Index of the physical package (socket)
+            size_t node;     // Index into nodes
+        };
+
+        ///   Core
+        /// @brief A physical core, and its SMT siblings
+        struct Core {
+            size_t package;
+            size_t node;
+            CpuSet cpus;
+        };
+
+        ///   Cache
+        /// @brief A data or unified cache of level 2 or above, and the CPUs sharing it
+        struct Cache {
+            unsigned int level;
+            size_t size;     // Bytes, 0 if unknown
+            CpuSet cpus;
+        };
+
+        ///   Node
+        /// @brief A NUMA node
+        struct Node {
+            size_t id;       // The OS's node number
+            CpuSet cpus;
+        };
+
+        std::vector<Cpu> cpus;
+        std::vector<Core> cores;
+        std::vector<Cache> caches;
+        std::vector<Node> nodes;
+        size_t packages = 0;
+
+        ///   online
+        /// @brief All CPUs in `cpus`
+        CpuSet online;
+
+        ///   isolated {Linux}
+        /// @brief CPUs the scheduler leaves to threads pinned there, from `isolcpus=` - empty otherwise
+        CpuSet isolated;
+
+        ///   nohz_full {Linux}
+        /// @brief CPUs whose scheduler tick stops while they run a single thread, from `nohz_full=`
+        CpuSet nohz_full;
+
+        ///   caches_at
+        /// @brief The caches of a given level, such as every L3 sharing group
+        std::vector<Cache> caches_at(unsigned int level) const;
+
+        ///   one_per_core
+        /// @brief The first SMT sibling of every core
+        CpuSet one_per_core() const;
+    };
+
+    ///   topology
+    /// @brief Topology of this machine, read once and then cached
+    ///
+    /// Linux reads sysfs, falling back to sched_getaffinity for the online
+    /// CPUs. Windows uses GetLogicalProcessorInformationEx across all
+    /// processor groups. Anything that can't be read is reported as one
+    /// core per CPU, one package and one node.
+    const Topology& topology();
+}
+
+// =====================================================================
+// >> Implementations
+// =====================================================================
+namespace simply {
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // ++ Topology
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    inline std::vector<Topology::Cache> Topology::caches_at(unsigned int level) const {
+        std::vector<Cache> found;
+        for ( const Cache& cache : caches )
+            if ( cache.level == level )
+                found.push_back(cache);
+        return found;
+    }
+
+    inline CpuSet Topology::one_per_core() const {
+        CpuSet first;
+        for ( const Core& core : cores )
+            first.set(core.cpus.first());
+        return first;
+    }
+
+    // Index of the set in `sets` containing `cpu`, or `fallback`
+    inline size_t _find_in(const std::vector<CpuSet>& sets, size_t cpu, size_t fallback) noexcept {
+        for ( size_t i = 0; i < sets.size(); i++ )
+            if ( sets[i].test(cpu) )
+                return i;
+        return fallback;
+    }
+
+    inline void _add_cache(Topology& topology, unsigned int level, size_t size, const CpuSet& cpus) {
+        for ( const Topology::Cache& cache : topology.caches )
+            if ( cache.level == level && cache.cpus == cpus )
+                return;
+        topology.caches.push_back(Topology::Cache{level, size, cpus});
+    }
+
+    // Fill in cpus, and anything left empty, from cores/packages/nodes
+    inline void _finish_topology(Topology& topology, const std::vector<CpuSet>& packages) {
+        if ( topology.cores.empty() )
+            for ( size_t cpu = 0; cpu < CpuSet::max_cpus; cpu++ )
+                if ( topology.online.test(cpu) )
+                    topology.cores.push_back(Topology::Core{0, 0, CpuSet({cpu})});
+        if ( topology.nodes.empty() )
+            topology.nodes.push_back(Topology::Node{0, topology.online});
+
+        topology.packages = std::max<size_t>(1, packages.size());
+        std::vector<CpuSet> nodes;
+        for ( const Topology::Node& node : topology.nodes )
+            nodes.push_back(node.cpus);
+
+        for ( size_t c = 0; c < topology.cores.size(); c++ ) {
+            Topology::Core& core = topology.cores[c];
+            size_t first = core.cpus.first();
+            core.package = _find_in(packages, first, 0);
+            core.node = _find_in(nodes, first, 0);
+            for ( size_t cpu = first; cpu < CpuSet::max_cpus; cpu++ )
+                if ( core.cpus.test(cpu) )
+                    topology.cpus.push_back(Topology::Cpu{cpu, c, core.package, core.node});
+        }
+    }
+
+    #if SIMPLY_WINDOWS
+        inline CpuSet _from_group_mask(const GROUP_AFFINITY& mask) {
+            CpuSet cpus;
+            for ( size_t bit = 0; bit < 64; bit++ )
+                if ( (mask.Mask & (KAFFINITY(1) << bit)) && mask.Group * 64 + bit < CpuSet::max_cpus )
+                    cpus.set(mask.Group * 64 + bit);
+            return cpus;
+        }
+
+        inline Topology _read_topology() {
+            Topology topology;
+            std::vector<CpuSet> packages;
+
+            DWORD length = 0;
+            GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+            std::vector<char> buffer(length);
+            auto* info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data());
+            if ( length && GetLogicalProcessorInformationEx(RelationAll, info, &length) ) {
+                for ( DWORD offset = 0; offset < length; ) {
+                    auto* record = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+                    switch ( record->Relationship ) {
+                        case RelationProcessorCore: {
+                            CpuSet cpus;
+                            for ( WORD g = 0; g < record->Processor.GroupCount; g++ ) {
+                                CpuSet group = _from_group_mask(record->Processor.GroupMask[g]);
+                                for ( size_t cpu = group.first(); cpu < CpuSet::max_cpus; cpu++ )
+                                    if ( group.test(cpu) )
+                                        cpus.set(cpu);
+                            }
+                            if ( !cpus.empty() )
+                                topology.cores.push_back(Topology::Core{0, 0, cpus});
+                            break;
+                        }
+                        case RelationProcessorPackage: {
+                            CpuSet cpus;
+                            for ( WORD g = 0; g < record->Processor.GroupCount; g++ ) {
+                                CpuSet group = _from_group_mask(record->Processor.GroupMask[g]);
+                                for ( size_t cpu = group.first(); cpu < CpuSet::max_cpus; cpu++ )
+                                    if ( group.test(cpu) )
+                                        cpus.set(cpu);
+                            }
+                            packages.push_back(cpus);
+                            break;
+                        }
+                        case RelationNumaNode:
+                            topology.nodes.push_back(Topology::Node{
+                                record->NumaNode.NodeNumber,
+                                _from_group_mask(record->NumaNode.GroupMask)
+                            });
+                            break;
+                        case RelationCache:
+                            if ( record->Cache.Level >= 2 && record->Cache.Type != CacheInstruction )
+                                _add_cache(topology, record->Cache.Level, record->Cache.CacheSize, _from_group_mask(record->Cache.GroupMask));
+                            break;
+                        default:
+                            break;
+                    }
+                    offset += record->Size;
+                }
+            }
+
+            for ( const Topology::Core& core : topology.cores )
+                for ( size_t cpu = core.cpus.first(); cpu < CpuSet::max_cpus; cpu++ )
+                    if ( core.cpus.test(cpu) )
+                        topology.online.set(cpu);
+            if ( topology.online.empty() )
+                topology.online = this_thread::get_affinity();
+
+            _finish_topology(topology, packages);
+            return topology;
+        }
+
+    #elif SIMPLY_LINUX
+        inline bool _read_sysfs(const std::string& path, std::string& value) {
+            std::ifstream file(path);
+            return static_cast<bool>(std::getline(file, value));
+        }
+
+        // Parses the kernel's cpulist format, such as "0-3,8,10-11"
+        inline CpuSet _parse_cpu_list(const std::string& list) {
+            CpuSet cpus;
+            const char* p = list.c_str();
+            while ( *p ) {
+                char* end;
+                unsigned long first = std::strtoul(p, &end, 10);
+                if ( end == p )
+                    break;
+                unsigned long last = first;
+                p = end;
+                if ( *p == '-' ) {
+                    last = std::strtoul(p + 1, &end, 10);
+                    p = end;
+                }
+                for ( unsigned long cpu = first; cpu <= last && cpu < CpuSet::max_cpus; cpu++ )
+                    cpus.set(cpu);
+                while ( *p == ',' || *p == ' ' )
+                    p++;
+            }
+            return cpus;
+        }
+
+        // Parses sizes such as "32K" or "1024K"
+        inline size_t _parse_cache_size(const std::string& size) {
+            char* end;
+            size_t bytes = std::strtoul(size.c_str(), &end, 10);
+            if ( *end == 'K' )
+                bytes *= 1024;
+            else if ( *end == 'M' )
+                bytes *= 1024 * 1024;
+            return bytes;
+        }
+
+        inline Topology _read_topology() {
+            const std::string root = "/sys/devices/system/cpu/";
+            Topology topology;
+            std::vector<CpuSet> packages;
+            std::vector<long> package_ids;
+
+            std::string value;
+            if ( _read_sysfs(root + "online", value) )
+                topology.online = _parse_cpu_list(value);
+            if ( topology.online.empty() )
+                topology.online = this_thread::get_affinity();
+            // Either can read "(null)" when the kernel has the option but none are set
+            if ( _read_sysfs(root + "isolated", value) )
+                topology.isolated = _parse_cpu_list(value);
+            if ( _read_sysfs(root + "nohz_full", value) )
+                topology.nohz_full = _parse_cpu_list(value);
+
+            for ( size_t cpu = 0; cpu < CpuSet::max_cpus; cpu++ ) {
+                if ( !topology.online.test(cpu) )
+                    continue;
+                const std::string dir = root + "cpu" + std::to_string(cpu) + "/";
+
+                // Cores are recorded once, by their lowest online sibling -
+                // offline siblings are left out, so they can't drop the core
+                CpuSet siblings({cpu});
+                if ( _read_sysfs(dir + "topology/thread_siblings_list", value) )
+                    siblings = _parse_cpu_list(value);
+                siblings.set(cpu);
+                for ( size_t sibling = siblings.first(); sibling < CpuSet::max_cpus; sibling++ )
+                    if ( siblings.test(sibling) && !topology.online.test(sibling) )
+                        siblings.reset(sibling);
+                if ( siblings.first() == cpu )
+                    topology.cores.push_back(Topology::Core{0, 0, siblings});
+
+                long package = 0;
+                if ( _read_sysfs(dir + "topology/physical_package_id", value) )
+                    package = std::strtol(value.c_str(), nullptr, 10);
+                size_t p = 0;
+                while ( p < package_ids.size() && package_ids[p] != package )
+                    p++;
+                if ( p == package_ids.size() ) {
+                    package_ids.push_back(package);
+                    packages.push_back(CpuSet());
+                }
+                packages[p].set(cpu);
+
+                for ( int index = 0; ; index++ ) {
+                    const std::string cache = dir + "cache/index" + std::to_string(index) + "/";
+                    std::string level, type, shared, size;
+                    if ( !_read_sysfs(cache + "level", level) )
+                        break;
+                    _read_sysfs(cache + "type", type);
+                    if ( std::atoi(level.c_str()) < 2 || type == "Instruction" )
+                        continue;
+                    if ( !_read_sysfs(cache + "shared_cpu_list", shared) )
+                        continue;
+                    _read_sysfs(cache + "size", size);
+                    _add_cache(topology, std::atoi(level.c_str()), _parse_cache_size(size), _parse_cpu_list(shared));
+                }
+            }
+
+            std::string possible;
+            if ( _read_sysfs("/sys/devices/system/node/online", possible) ) {
+                CpuSet node_ids = _parse_cpu_list(possible);
+                for ( size_t node = 0; node < CpuSet::max_cpus; node++ ) {
+                    if ( !node_ids.test(node) )
+                        continue;
+                    if ( _read_sysfs("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", value) ) {
+                        CpuSet cpus = _parse_cpu_list(value);
+                        if ( !cpus.empty() )
+                            topology.nodes.push_back(Topology::Node{node, cpus});
+                    }
+                }
+            }
+
+            _finish_topology(topology, packages);
+            return topology;
+        }
+    #endif
+
+    inline const Topology& topology() {
+        static const Topology cached = _read_topology();
+        return cached;
+    }
+}
+
+#endif // SIMPLY_TOPOLOGY_H_
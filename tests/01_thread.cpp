@@ -11,8 +11,11 @@
 
 #include "gtest/gtest.h"
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <memory>
+#include <string>
 #include <system_error>
 
 #if SIMPLY_std20plus
@@ -38,6 +41,28 @@ TEST(Id, Null) {
     ASSERT_EQ(Thread::id(), Thread::id());
 }
 
+// ============
+// >> CpuSet
+// ============
+TEST(CpuSet, Basic) {
+    CpuSet cpus;
+    EXPECT_TRUE(cpus.empty());
+    EXPECT_EQ(cpus.first(), CpuSet::max_cpus);
+
+    cpus.set(3).set(1);
+    EXPECT_EQ(cpus.count(), 2u);
+    EXPECT_EQ(cpus.first(), 1u);
+    EXPECT_TRUE(cpus.test(3));
+    EXPECT_FALSE(cpus.test(2));
+    EXPECT_EQ(cpus, CpuSet({1, 3}));
+
+    cpus.reset(1);
+    EXPECT_NE(cpus, CpuSet({1, 3}));
+    EXPECT_THROW(cpus.set(CpuSet::max_cpus), std::system_error);
+    cpus.clear();
+    EXPECT_TRUE(cpus.empty());
+}
+
 // ===========
 // >> Thread
 // ===========
@@ -55,6 +80,9 @@ TEST(Thread, Null) {
     EXPECT_THROW(thread.join_until(std::chrono::high_resolution_clock::now()), std::system_error);
     EXPECT_THROW(thread.detach(), std::system_error);
 
+    EXPECT_THROW(thread.set_affinity(CpuSet({0})), std::system_error);
+    EXPECT_THROW(thread.get_affinity(), std::system_error);
+
     // 3. Must have id equal to default
     EXPECT_EQ(thread.get_id(), Thread::id());
 
@@ -111,7 +139,164 @@ TEST(Thread, Move) {
 
 #else
 TEST(Thread, LinuxOptions) {
-    /// Todo...
+    Thread null_thread;
+    EXPECT_THROW(null_thread.set_scheduling(Thread::Policy::IDLE), std::system_error);
+    EXPECT_THROW(null_thread.get_policy(), std::system_error);
+    EXPECT_THROW(this_thread::set_scheduling(Thread::Policy::FIFO, 100), std::system_error);
+    EXPECT_THROW(this_thread::set_scheduling(Thread::Policy::DEADLINE), std::system_error);
+    EXPECT_THROW(this_thread::set_nice(20), std::system_error);
+    EXPECT_THROW(this_thread::set_deadline(std::chrono::milliseconds(2), std::chrono::milliseconds(1)), std::system_error);
+
+    // Lowering a thread's share of the CPU needs no privilege
+    std::atomic<bool> done{false};
+    Thread thread([&done](){ while ( !done ) this_thread::sleep(1); });
+    EXPECT_EQ(thread.get_policy(), Thread::Policy::OTHER);
+    thread.set_scheduling(Thread::Policy::BATCH);
+    EXPECT_EQ(thread.get_policy(), Thread::Policy::BATCH);
+    EXPECT_EQ(thread.get_priority(), 0);
+    done = true;
+    thread.join();
+
+    Thread::Policy policy = Thread::Policy::OTHER;
+    int nice = 0;
+    Thread([&](){
+        this_thread::set_scheduling(Thread::Policy::IDLE);
+        this_thread::set_nice(this_thread::get_nice() + 1);
+        policy = this_thread::get_policy();
+        nice = this_thread::get_nice();
+    }).join();
+    EXPECT_EQ(policy, Thread::Policy::IDLE);
+    EXPECT_GT(nice, 0);
+
+    // Nice is applied before the thread function, through either start path
+    Thread(Thread::Attributes().nice(19), [&nice](){ nice = this_thread::get_nice(); }).join();
+    EXPECT_EQ(nice, 19);
+    std::array<int, 64> values {};
+    Thread(Thread::Attributes().nice(18), [&nice, values](){ nice = this_thread::get_nice() + values[0]; }).join();
+    EXPECT_EQ(nice, 18);
+}
+
+TEST(Thread, RealTime) {
+    // Real-time policies need privileges, in which case they must apply
+    // to the first instruction - and otherwise the thread must never run
+    bool ran = false;
+    int policy = -1;
+    try {
+        Thread(Thread::Attributes().scheduling(Thread::Policy::FIFO, 10), [&](){
+            ran = true;
+            policy = sched_getscheduler(0);
+        }).join();
+        EXPECT_EQ(policy, SCHED_FIFO);
+    }
+    catch ( const std::system_error& ) {
+        EXPECT_FALSE(ran);
+    }
+
+    ran = false;
+    try {
+        auto attributes = Thread::Attributes().deadline(std::chrono::microseconds(100), std::chrono::milliseconds(1), std::chrono::milliseconds(10));
+        Thread(attributes, [&](){
+            ran = true;
+            policy = sched_getscheduler(0);
+        }).join();
+        EXPECT_EQ(policy, SCHED_DEADLINE);
+    }
+    catch ( const std::system_error& ) {
+        EXPECT_FALSE(ran);
+    }
+}
+
+// Usable stack size of the calling thread
+static size_t current_stack_size() {
+    pthread_attr_t attr;
+    void* addr;
+    size_t size = 0;
+    pthread_getattr_np(pthread_self(), &attr);
+    pthread_attr_getstack(&attr, &addr, &size);
+    pthread_attr_destroy(&attr);
+    return size;
+}
+
+TEST(Thread, StackSize) {
+    const size_t requested = 256 * 1024;
+    size_t size = 0;
+    Thread thread(requested, [&size](){ size = current_stack_size(); });
+    thread.join();
+    EXPECT_GE(size, requested);
+    EXPECT_LT(size, 2 * requested);
+}
+
+TEST(Thread, Attributes) {
+    EXPECT_THROW(Thread::Attributes().name("much_too_long_a_name"), std::system_error);
+    EXPECT_THROW(Thread::Attributes().affinity(CpuSet()), std::system_error);
+    EXPECT_THROW(Thread::Attributes().scheduling(Thread::Policy::BATCH, 10), std::system_error);
+    EXPECT_THROW(Thread::Attributes().scheduling(Thread::Policy::FIFO, 0), std::system_error);
+
+    CpuSet pinned({this_thread::get_affinity().first()});
+    Thread::Attributes attributes;
+    attributes.stack_size(256 * 1024)
+              .guard_size(16 * 1024)
+              .affinity(pinned)
+              .scheduling(Thread::Policy::BATCH)
+              .name("configured");
+
+    // Everything must already apply to the first instruction of the thread
+    std::string name;
+    CpuSet cpus;
+    int policy = -1;
+    size_t stack = 0, guard = 0;
+    Thread thread(attributes, [&](){
+        name   = this_thread::get_name();
+        cpus   = this_thread::get_affinity();
+        policy = sched_getscheduler(0);
+        stack  = current_stack_size();
+
+        pthread_attr_t attr;
+        pthread_getattr_np(pthread_self(), &attr);
+        pthread_attr_getguardsize(&attr, &guard);
+        pthread_attr_destroy(&attr);
+    });
+    thread.join();
+    EXPECT_EQ(name, "configured");
+    EXPECT_EQ(cpus, pinned);
+    EXPECT_EQ(policy, SCHED_BATCH);
+    EXPECT_GE(stack, 256u * 1024);
+    EXPECT_EQ(guard, 16u * 1024);
+
+    // Large payloads take the heap path, and must still be named before starting
+    std::array<int, 64> values {};
+    Thread(Thread::Attributes().name("heap"), [&name, values](){
+        name = this_thread::get_name() + std::to_string(values[0]);
+    }).join();
+    EXPECT_EQ(name, "heap0");
+}
+
+TEST(Thread, StackPool) {
+    StackPool pool(64 * 1024, 0, true);
+    EXPECT_GE(pool.stack_size(), 64u * 1024);
+    EXPECT_GT(pool.guard_size(), 0u);
+
+    pool.reserve(4);
+    EXPECT_EQ(pool.available(), 4u);
+
+    std::atomic<int> count{0};
+    {
+        Thread t1(pool, [&count](){ count++; });
+        Thread t2(pool, [&count](int v){ count += v; }, 2);
+        EXPECT_EQ(pool.available(), 2u);
+
+        // Stacks can't be reused after detach, so that is refused
+        EXPECT_THROW(t1.detach(), std::system_error);
+        EXPECT_TRUE(t1.joinable());
+    }
+    EXPECT_EQ(count.load(), 3);
+    EXPECT_EQ(pool.available(), 4u);
+
+    // Stacks are handed out again after join
+    for ( int i = 0; i < 100; i++ )
+        Thread(pool, [&count](){ count++; }).join();
+    EXPECT_EQ(count.load(), 103);
+    EXPECT_EQ(pool.available(), 4u);
 }
 
 #endif
@@ -119,7 +304,68 @@ TEST(Thread, LinuxOptions) {
 // These are a little more finicky as the times don't guarantee order,
 // just "encourage" order of execution
 TEST(Thread, Timing) {
-    
+    using namespace std::chrono;
+    using clock = steady_clock;
+
+    // Sleeps may run long, but never short
+    auto start = clock::now();
+    this_thread::sleep_for(microseconds(200));
+    EXPECT_GE(clock::now() - start, microseconds(200));
+
+    start = clock::now();
+    this_thread::sleep(1200);
+    EXPECT_GE(clock::now() - start, milliseconds(1200));
+
+    // Deadlines are absolute, so a paced loop doesn't drift
+    start = clock::now();
+    auto deadline = start;
+    for ( int i = 0; i < 10; i++ )
+        this_thread::sleep_until(deadline += microseconds(500));
+    EXPECT_GE(clock::now() - start, milliseconds(5));
+
+    start = clock::now();
+    this_thread::sleep_until(start - seconds(1));
+    this_thread::sleep_until(system_clock::now() + microseconds(100));
+    EXPECT_LT(clock::now() - start, seconds(1));
+
+    // Hybrid sleeps spin until the deadline
+    deadline = clock::now() + milliseconds(2);
+    this_thread::sleep_until(deadline, microseconds(500));
+    EXPECT_GE(clock::now(), deadline);
+    start = clock::now();
+    this_thread::sleep_for(microseconds(100), microseconds(200));
+    EXPECT_GE(clock::now() - start, microseconds(100));
+
+    EXPECT_THROW(this_thread::sleep_for(milliseconds(-1)), std::system_error);
+    EXPECT_THROW(this_thread::sleep_until(clock::now(), nanoseconds(-1)), std::system_error);
+}
+
+TEST(Thread, TimedJoin) {
+    using namespace std::chrono;
+    using clock = steady_clock;
+
+    std::atomic<bool> done{false};
+    Thread thread([&done](){ while ( !done ) this_thread::sleep(1); });
+
+    // A timed out join waits as long as asked, and leaves the thread joinable
+    auto start = clock::now();
+    EXPECT_FALSE(thread.join_for(microseconds(500)));
+    EXPECT_GE(clock::now() - start, microseconds(500));
+    EXPECT_TRUE(thread.joinable());
+    EXPECT_FALSE(thread.join_until(system_clock::now() + microseconds(200)));
+    EXPECT_FALSE(thread.join(0));
+
+    done = true;
+    EXPECT_TRUE(thread.join_for(seconds(10)));
+    EXPECT_FALSE(thread.joinable());
+
+    // A deadline that has passed still joins a finished thread
+    Thread finished([](){});
+    this_thread::sleep(10);
+    EXPECT_TRUE(finished.join_until(clock::now() - seconds(1)));
+
+    Thread forever([](){});
+    EXPECT_TRUE(forever.join_for(hours::max()));
 }
 
 #if SIMPLY_std20plus
@@ -145,6 +391,32 @@ TEST(Thread, Timing) {
         t2.join();
         EXPECT_TRUE(stopped);
     }
+
+    TEST(Thread, StoppableSleep) {
+        using namespace std::chrono;
+        std::stop_source source;
+        EXPECT_TRUE(this_thread::sleep_for(milliseconds(1), source.get_token()));
+        EXPECT_TRUE(this_thread::sleep_until(system_clock::now() + milliseconds(1), source.get_token()));
+        EXPECT_TRUE(this_thread::sleep_for(milliseconds(1), std::stop_token()));
+        EXPECT_THROW(this_thread::sleep_for(milliseconds(-1), source.get_token()), std::system_error);
+
+        // Joining wakes a long sleep at once
+        bool slept = true;
+        Thread sleeper([&slept](std::stop_token token){
+            slept = this_thread::sleep_for(hours(1), token);
+        });
+        this_thread::sleep(10);
+        auto begin = steady_clock::now();
+        sleeper.join();
+        EXPECT_FALSE(slept);
+        EXPECT_LT(steady_clock::now() - begin, seconds(5));
+
+        // Already stopped
+        source.request_stop();
+        EXPECT_FALSE(this_thread::sleep_for(hours(1), source.get_token()));
+        EXPECT_FALSE(this_thread::sleep_until(steady_clock::now() + hours(1), source.get_token()));
+        EXPECT_FALSE(this_thread::sleep_until(system_clock::now() + hours(1), source.get_token()));
+    }
 #endif
 
 // ======================
@@ -186,4 +458,198 @@ TEST(Thread, Callables) {
     EXPECT_TRUE(global_flag);
 
     EXPECT_NO_THROW(Thread t(simple_arg, 1));
-}
\ No newline at end of file
+}
+
+TEST(Thread, Payloads) {
+    // Small payloads are handed over on the spawning thread's stack
+    int result = 0;
+    auto small = [&result](int a, int b){ result = a + b; };
+    Thread(small, 1, 2).join();
+    EXPECT_EQ(result, 3);
+
+    // Large payloads are copied to the heap
+    std::array<int, 64> values;
+    values.fill(1);
+    auto large = [values, &result](){ result = 0; for ( int v : values ) result += v; };
+    Thread(large).join();
+    EXPECT_EQ(result, 64);
+
+    // Move-only arguments are moved through either path
+    auto owned = [&result](std::unique_ptr<int> p){ result = *p; };
+    Thread(owned, std::make_unique<int>(7)).join();
+    EXPECT_EQ(result, 7);
+}
+
+TEST(Thread, Stats) {
+    Thread null_thread;
+    EXPECT_THROW(null_thread.stats(), std::system_error);
+
+    // Burn some CPU, then block, so both show up
+    auto burn = [](){
+        while ( this_thread::stats().cpu_time < std::chrono::milliseconds(25) )
+            ;
+    };
+    std::atomic<bool> done{false};
+    std::atomic<bool> burnt{false};
+    Thread thread([&](){
+        burn();
+        burnt = true;
+        while ( !done )
+            this_thread::sleep(1);
+    });
+    while ( !burnt )
+        this_thread::sleep(1);
+    this_thread::sleep(20);
+
+    Thread::Stats stats = thread.stats();
+    EXPECT_GE(stats.cpu_time, std::chrono::milliseconds(20));
+    EXPECT_LT(stats.cpu, CpuSet::max_cpus);
+    #if SIMPLY_LINUX
+        EXPECT_GT(stats.voluntary_switches, 0u);
+    #endif
+    done = true;
+    thread.join();
+
+    Thread::Stats mine;
+    Thread([&](){
+        burn();
+        this_thread::sleep(1);
+        mine = this_thread::stats();
+    }).join();
+    EXPECT_GE(mine.cpu_time, std::chrono::milliseconds(20));
+    EXPECT_GE(mine.user_time + mine.system_time, std::chrono::milliseconds(10));
+    EXPECT_TRUE(this_thread::get_affinity().test(mine.cpu));
+    #if SIMPLY_LINUX
+        EXPECT_GT(mine.voluntary_switches, 0u);
+    #endif
+}
+
+TEST(Thread, Affinity) {
+    CpuSet allowed = this_thread::get_affinity();
+    ASSERT_FALSE(allowed.empty());
+    EXPECT_THROW(this_thread::set_affinity(CpuSet()), std::system_error);
+
+    // Pin a thread to the first CPU this process may use
+    CpuSet pinned({allowed.first()});
+    std::atomic<bool> done{false};
+    Thread thread([&done](){ while ( !done ) this_thread::sleep(1); });
+    thread.set_affinity(pinned);
+    EXPECT_EQ(thread.get_affinity(), pinned);
+    done = true;
+    thread.join();
+
+    CpuSet seen;
+    Thread([&seen, &pinned](){
+        this_thread::set_affinity(pinned);
+        seen = this_thread::get_affinity();
+    }).join();
+    EXPECT_EQ(seen, pinned);
+}
+
+TEST(Thread, QoS) {
+    // Applied before the thread function, and read back from the thread itself
+    for ( Thread::QoS qos : {Thread::QoS::LATENCY, Thread::QoS::EFFICIENCY, Thread::QoS::BACKGROUND, Thread::QoS::DEFAULT} ) {
+        Thread::QoS seen = Thread::QoS::DEFAULT;
+        Thread(Thread::Attributes().qos(qos), [&seen](){ seen = this_thread::get_qos(); }).join();
+        EXPECT_EQ(seen, qos);
+    }
+
+    // BACKGROUND is also the idle priority
+    std::atomic<bool> done{false};
+    Thread thread([&done](){ while ( !done ) this_thread::sleep(1); });
+    thread.set_qos(Thread::QoS::BACKGROUND);
+    EXPECT_EQ(thread.get_qos(), Thread::QoS::BACKGROUND);
+    #if SIMPLY_WINDOWS
+        EXPECT_EQ(thread.get_priority(), Thread::Priority::IDLE);
+    #else
+        EXPECT_EQ(thread.get_policy(), Thread::Policy::IDLE);
+    #endif
+    done = true;
+    thread.join();
+
+    #if SIMPLY_LINUX
+        // Wakeups are coalesced within the timer slack, and an explicit policy wins
+        unsigned long slack = 0;
+        Thread::Policy policy = Thread::Policy::OTHER;
+        Thread(Thread::Attributes().qos(Thread::QoS::EFFICIENCY).scheduling(Thread::Policy::IDLE), [&](){
+            slack = static_cast<unsigned long>(prctl(PR_GET_TIMERSLACK, 0, 0, 0, 0));
+            policy = this_thread::get_policy();
+        }).join();
+        EXPECT_GE(slack, 1000000u);
+        EXPECT_EQ(policy, Thread::Policy::IDLE);
+
+        // Also one set by pthread_create, which BACKGROUND must not replace
+        int native = -1;
+        Thread(Thread::Attributes().scheduling(Thread::Policy::OTHER, 0).qos(Thread::QoS::BACKGROUND), [&](){
+            native = sched_getscheduler(0);
+            policy = this_thread::get_policy();
+        }).join();
+        EXPECT_EQ(native, SCHED_OTHER);
+        EXPECT_EQ(policy, Thread::Policy::OTHER);
+    #endif
+}
+
+// ================
+// >> this_thread
+// ================
+TEST(ThisThread, Cached) {
+    CpuSet pinned({this_thread::get_affinity().first()});
+    std::atomic<int> step{0};
+    std::string names[3];
+    CpuSet seen;
+    Thread::id id;
+    Thread thread(Thread::Attributes().name("cached"), [&](){
+        id = this_thread::get_id();
+        names[0] = this_thread::get_name();
+        this_thread::set_name("renamed");
+        names[1] = this_thread::get_name();
+        this_thread::get_affinity();
+        step = 1;
+
+        // Changed from the spawning thread, so the cache must not be kept
+        while ( step != 2 )
+            this_thread::sleep(1);
+        names[2] = this_thread::get_name();
+        seen = this_thread::get_affinity();
+    });
+    while ( step != 1 )
+        this_thread::sleep(1);
+    thread.set_name("outside");
+    thread.set_affinity(pinned);
+    Thread::id expected = thread.get_id();
+    step = 2;
+    thread.join();
+
+    EXPECT_EQ(id, expected);
+    EXPECT_EQ(names[0], "cached");
+    EXPECT_EQ(names[1], "renamed");
+    EXPECT_EQ(names[2], "outside");
+    EXPECT_EQ(seen, pinned);
+    EXPECT_EQ(this_thread::get_id(), this_thread::get_id());
+}
+
+#if SIMPLY_std20plus
+    TEST(ThisThread, StopToken) {
+        // Not a simply::Thread
+        EXPECT_FALSE(this_thread::get_stop_token().stop_possible());
+
+        // The function needn't take the token for this thread to see it
+        std::atomic<bool> stopped{false};
+        Thread thread([&stopped](){
+            std::stop_token token = this_thread::get_stop_token();
+            while ( !token.stop_requested() )
+                this_thread::sleep(1);
+            stopped = true;
+        });
+        thread.request_stop();
+        thread.join();
+        EXPECT_TRUE(stopped);
+
+        // Or when it does
+        bool same = false;
+        Thread([&same](std::stop_token token){
+            same = token == this_thread::get_stop_token();
+        }).join();
+        EXPECT_TRUE(same);
+    }
+#endif
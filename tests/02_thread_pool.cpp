@@ -0,0 +1,84 @@
+/**
+ * @file 02_thread_pool.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `ThreadPool` from `simply-threading`
+ */
+#include <simply/thread_pool.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+
+using namespace simply;
+
+// ===============
+// >> ThreadPool
+// ===============
+TEST(ThreadPool, Size) {
+    ThreadPool pool(3);
+    EXPECT_EQ(pool.size(), 3u);
+
+    ThreadPool default_pool;
+    EXPECT_GT(default_pool.size(), 0u);
+}
+
+TEST(ThreadPool, Submit) {
+    std::atomic<int> count{0};
+    ThreadPool pool(4);
+    for ( int i = 0; i < 10000; i++ )
+        pool.submit([&count](){ count.fetch_add(1); });
+    pool.wait_idle();
+    EXPECT_EQ(count.load(), 10000);
+
+    // Arguments are copied into the task
+    pool.submit([&count](int v){ count.fetch_add(v); }, 5);
+    pool.wait_idle();
+    EXPECT_EQ(count.load(), 10005);
+}
+
+TEST(ThreadPool, NestedSubmit) {
+    std::atomic<int> count{0};
+    ThreadPool pool(4);
+    for ( int i = 0; i < 100; i++ )
+        pool.submit([&pool, &count](){
+            // Spawned tasks go onto the worker's own deque, and get stolen from there
+            EXPECT_EQ(ThreadPool::current(), &pool);
+            for ( int j = 0; j < 100; j++ )
+                pool.submit([&count](){ count.fetch_add(1); });
+        });
+    pool.wait_idle();
+    EXPECT_EQ(count.load(), 100 * 100);
+    EXPECT_EQ(ThreadPool::current(), nullptr);
+}
+
+TEST(ThreadPool, Workers) {
+    std::mutex mutex;
+    std::set<size_t> indices;
+    ThreadPool pool(2, "worker");
+    for ( int i = 0; i < 100; i++ )
+        pool.submit([&](){
+            this_thread::sleep(1);
+            std::lock_guard<std::mutex> lock(mutex);
+            indices.insert(ThreadPool::current_index());
+            EXPECT_EQ(this_thread::get_name().rfind("worker_", 0), 0u);
+        });
+    pool.wait_idle();
+    for ( size_t index : indices )
+        EXPECT_LT(index, 2u);
+}
+
+TEST(ThreadPool, DrainOnDestruction) {
+    std::atomic<int> count{0};
+    {
+        ThreadPool pool(2);
+        for ( int i = 0; i < 1000; i++ )
+            pool.submit([&count](){ count.fetch_add(1); });
+    }
+    EXPECT_EQ(count.load(), 1000);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file 03_topology.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for `topology()` from `simply-threading`
+ */
+#include <simply/topology.h>
+
+#include "gtest/gtest.h"
+
+using namespace simply;
+
+// ==============
+// >> Topology
+// ==============
+TEST(Topology, Cached) {
+    EXPECT_EQ(&topology(), &topology());
+}
+
+TEST(Topology, Cpus) {
+    const Topology& t = topology();
+    ASSERT_FALSE(t.cpus.empty());
+    EXPECT_EQ(t.cpus.size(), t.online.count());
+    EXPECT_LE(t.cpus.size(), Thread::hardware_concurrency());
+
+    // The calling thread can only run on CPUs that are online
+    CpuSet allowed = this_thread::get_affinity();
+    for ( size_t cpu = allowed.first(); cpu < CpuSet::max_cpus; cpu++ )
+        EXPECT_TRUE(!allowed.test(cpu) || t.online.test(cpu)) << "cpu " << cpu;
+}
+
+TEST(Topology, Cores) {
+    const Topology& t = topology();
+    ASSERT_FALSE(t.cores.empty());
+    EXPECT_LE(t.cores.size(), t.cpus.size());
+    EXPECT_EQ(t.one_per_core().count(), t.cores.size());
+    EXPECT_GE(t.packages, 1u);
+
+    // Each CPU is in exactly the core it refers to
+    for ( const Topology::Cpu& cpu : t.cpus ) {
+        ASSERT_LT(cpu.core, t.cores.size());
+        ASSERT_LT(cpu.node, t.nodes.size());
+        EXPECT_LT(cpu.package, t.packages);
+        for ( size_t c = 0; c < t.cores.size(); c++ )
+            EXPECT_EQ(t.cores[c].cpus.test(cpu.id), c == cpu.core);
+        EXPECT_TRUE(t.nodes[cpu.node].cpus.test(cpu.id));
+    }
+}
+
+TEST(Topology, Caches) {
+    const Topology& t = topology();
+    for ( const Topology::Cache& cache : t.caches ) {
+        EXPECT_GE(cache.level, 2u);
+        EXPECT_FALSE(cache.cpus.empty());
+    }
+    for ( const Topology::Cache& cache : t.caches_at(3) )
+        EXPECT_EQ(cache.level, 3u);
+}
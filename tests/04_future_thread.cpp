@@ -0,0 +1,111 @@
+/**
+ * @file 04_future_thread.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `FutureThread` from `simply-threading`
+ */
+#include <simply/future_thread.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace simply;
+
+// ==================
+// >> FutureThread
+// ==================
+TEST(FutureThread, Null) {
+    FutureThread<int> future;
+    EXPECT_FALSE(future.valid());
+    EXPECT_FALSE(future.ready());
+    EXPECT_FALSE(future.thread().joinable());
+    EXPECT_THROW(future.get(), std::system_error);
+    EXPECT_THROW(future.wait(), std::system_error);
+}
+
+TEST(FutureThread, Results) {
+    FutureThread sum([](int a, int b){ return a + b; }, 1, 2);
+    EXPECT_TRUE(sum.valid());
+    EXPECT_EQ(sum.get(), 3);
+    EXPECT_FALSE(sum.valid());
+    EXPECT_THROW(sum.get(), std::system_error);
+
+    bool ran = false;
+    FutureThread<void> nothing([&ran](){ ran = true; });
+    nothing.get();
+    EXPECT_TRUE(ran);
+
+    int value = 0;
+    FutureThread<int&> reference([&value]() -> int& { return value; });
+    EXPECT_EQ(&reference.get(), &value);
+
+    // Move-only results and arguments
+    FutureThread owned([](std::unique_ptr<int> p){ return p; }, std::make_unique<int>(7));
+    EXPECT_EQ(*owned.get(), 7);
+}
+
+TEST(FutureThread, Exceptions) {
+    FutureThread<int> failing([]() -> int { throw std::runtime_error("failed"); });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+    EXPECT_FALSE(failing.valid());
+}
+
+TEST(FutureThread, Waiting) {
+    std::atomic<bool> release{false};
+    FutureThread<std::string> future(Thread::Attributes().name("future"), [&release](){
+        while ( !release )
+            this_thread::sleep(1);
+        return this_thread::get_name();
+    });
+
+    EXPECT_FALSE(future.ready());
+    EXPECT_FALSE(future.wait_for(std::chrono::microseconds(500)));
+    EXPECT_FALSE(future.wait_until(std::chrono::system_clock::now() + std::chrono::microseconds(200)));
+
+    release = true;
+    EXPECT_TRUE(future.wait_for(std::chrono::seconds(10)));
+    EXPECT_TRUE(future.ready());
+    EXPECT_EQ(future.get(), "future");
+}
+
+TEST(FutureThread, FanOut) {
+    std::vector<FutureThread<int>> futures;
+    for ( int i = 0; i < 16; i++ )
+        futures.emplace_back([](int v){ return v * v; }, i);
+
+    int sum = 0;
+    for ( auto& future : futures )
+        sum += future.get();
+    EXPECT_EQ(sum, 1240);
+
+    // Move assignment joins the old thread before replacing its result
+    FutureThread<int> moved([](){ return 1; });
+    moved = FutureThread<int>([](){ return 2; });
+    EXPECT_EQ(moved.get(), 2);
+}
+
+#if SIMPLY_std20plus
+    TEST(FutureThread, StopToken) {
+        FutureThread stoppable([](std::stop_token token){
+            int spins = 0;
+            while ( !token.stop_requested() ) {
+                this_thread::sleep(1);
+                spins++;
+            }
+            return spins >= 0;
+        });
+        EXPECT_FALSE(stoppable.wait_for(std::chrono::milliseconds(5)));
+        stoppable.thread().request_stop();
+        EXPECT_TRUE(stoppable.get());
+    }
+#endif
@@ -0,0 +1,153 @@
+/**
+ * @file 05_thread_registry.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `ThreadRegistry` from `simply-threading`
+ */
+#include <simply/threading.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace simply;
+
+static const ThreadInfo* find(const std::vector<ThreadInfo>& threads, Thread::id id) {
+    for ( const ThreadInfo& info : threads )
+        if ( info.id == id )
+            return &info;
+    return nullptr;
+}
+
+// ====================
+// >> ThreadRegistry
+// ====================
+TEST(ThreadRegistry, OptIn) {
+    EXPECT_FALSE(ThreadRegistry::enabled());
+    std::atomic<bool> done{false};
+    Thread thread([&done](){ while ( !done ) this_thread::sleep(1); });
+    EXPECT_EQ(ThreadRegistry::size(), 0u);
+    EXPECT_TRUE(ThreadRegistry::snapshot().empty());
+    done = true;
+}
+
+TEST(ThreadRegistry, Snapshot) {
+    ThreadRegistry::enable();
+    auto before = std::chrono::system_clock::now();
+
+    std::atomic<bool> done{false};
+    auto wait = [&done](){ while ( !done ) this_thread::sleep(1); };
+    Thread first(Thread::Attributes().name("first"), wait);
+    Thread second(Thread::Attributes().name("second"), wait);
+    Thread unnamed(wait);
+
+    // Registration happens on the new thread, just after it starts
+    while ( ThreadRegistry::size() < 3 )
+        this_thread::sleep(1);
+
+    auto threads = ThreadRegistry::snapshot(true);
+    EXPECT_EQ(threads.size(), 3u);
+    const ThreadInfo* info = find(threads, first.get_id());
+    ASSERT_NE(info, nullptr);
+    EXPECT_EQ(info->name, "first");
+    EXPECT_NE(info->os_id, 0u);
+    EXPECT_GE(info->started, std::chrono::time_point_cast<std::chrono::system_clock::duration>(before - std::chrono::seconds(1)));
+    ASSERT_NE(find(threads, second.get_id()), nullptr);
+    EXPECT_EQ(find(threads, second.get_id())->name, "second");
+    ASSERT_NE(find(threads, unnamed.get_id()), nullptr);
+
+    // Renaming updates the cached name, from either side
+    second.set_name("renamed");
+    EXPECT_EQ(find(ThreadRegistry::snapshot(), second.get_id())->name, "renamed");
+
+    // Threads leave once their function returns, and their slot is reused
+    done = true;
+    first.join();
+    second.join();
+    unnamed.join();
+    EXPECT_EQ(ThreadRegistry::size(), 0u);
+
+    Thread::id id;
+    std::string name;
+    Thread([&](){
+        this_thread::set_name("self");
+        id = this_thread::get_id();
+        name = find(ThreadRegistry::snapshot(), id)->name;
+    }).join();
+    EXPECT_EQ(name, "self");
+
+    ThreadRegistry::enable(false);
+}
+
+TEST(ThreadRegistry, Attributes) {
+    ThreadRegistry::enable();
+    std::atomic<bool> done{false};
+    auto spin = [&done](){ while ( !done ) ; };
+    auto attributes = Thread::Attributes().name("attributed").stack_size(256 * 1024).affinity(CpuSet({0})).arena(4096);
+    #if SIMPLY_LINUX
+        attributes.nice(5);
+    #endif
+    Thread thread(attributes, spin);
+    Thread plain(spin);
+    while ( ThreadRegistry::size() < 2 )
+        this_thread::sleep(1);
+
+    auto threads = ThreadRegistry::snapshot(true);
+    const ThreadInfo* info = find(threads, thread.get_id());
+    ASSERT_NE(info, nullptr);
+    EXPECT_EQ(info->attributes.name(), "attributed");
+    EXPECT_EQ(info->attributes.stack_size(), 256u * 1024);
+    EXPECT_EQ(info->attributes.arena(), 4096u);
+    ASSERT_TRUE(info->attributes.affinity());
+    EXPECT_EQ(info->attributes.affinity()->count(), 1u);
+    EXPECT_TRUE(info->attributes.affinity()->test(0));
+    EXPECT_FALSE(info->attributes.qos());
+    #if SIMPLY_LINUX
+        EXPECT_EQ(info->attributes.nice(), std::optional<int>(5));
+        EXPECT_FALSE(info->attributes.policy());
+    #endif
+
+    const ThreadInfo* plain_info = find(threads, plain.get_id());
+    ASSERT_NE(plain_info, nullptr);
+    EXPECT_EQ(plain_info->attributes.stack_size(), 0u);
+    EXPECT_FALSE(plain_info->attributes.affinity());
+    EXPECT_TRUE(plain_info->attributes.name().empty());
+
+    // The stats can be sampled again without another snapshot
+    this_thread::sleep(20);
+    EXPECT_GT(info->sample_stats().cpu_time, info->stats.cpu_time);
+
+    done = true;
+    thread.join();
+    plain.join();
+    ThreadRegistry::enable(false);
+}
+
+TEST(ThreadRegistry, Dump) {
+    ThreadRegistry::enable();
+    std::atomic<bool> done{false};
+    Thread thread(Thread::Attributes().name("dumped"), [&done](){ while ( !done ) this_thread::sleep(1); });
+    while ( ThreadRegistry::size() < 1 )
+        this_thread::sleep(1);
+
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    ThreadRegistry::dump(fileno(file));
+    std::rewind(file);
+    char line[256] = {};
+    ASSERT_NE(std::fgets(line, sizeof(line), file), nullptr);
+    std::fclose(file);
+    EXPECT_NE(std::string(line).find(" dumped started="), std::string::npos);
+
+    done = true;
+    thread.join();
+    ThreadRegistry::enable(false);
+}
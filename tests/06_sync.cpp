@@ -0,0 +1,217 @@
+/**
+ * @file 06_sync.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for `Event`, `Latch`, `Barrier` and `AdaptiveMutex` from `simply-threading`
+ */
+#include <simply/sync.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+using namespace simply;
+using namespace std::chrono;
+
+// ===========
+// >> Event
+// ===========
+TEST(Event, SetAndReset) {
+    Event event;
+    EXPECT_FALSE(event.is_set());
+    EXPECT_FALSE(event.wait_for(milliseconds(1)));
+    EXPECT_FALSE(event.wait_until(system_clock::now() + milliseconds(1)));
+
+    event.set();
+    EXPECT_TRUE(event.is_set());
+    event.wait();
+    EXPECT_TRUE(event.wait_for(hours(1)));
+    event.set();
+    EXPECT_TRUE(event.is_set());
+
+    event.reset();
+    EXPECT_FALSE(event.is_set());
+    EXPECT_TRUE(Event(true).is_set());
+}
+
+TEST(Event, WakesWaiters) {
+    Event event;
+    std::atomic<int> woken{0};
+    std::vector<Thread> waiters;
+    for ( int i = 0; i < 4; i++ )
+        waiters.emplace_back([&](){ event.wait(); woken++; });
+
+    this_thread::sleep(20);
+    EXPECT_EQ(woken, 0);
+    event.set();
+    for ( Thread& waiter : waiters )
+        waiter.join();
+    EXPECT_EQ(woken, 4);
+
+    // A reset while parked still leaves the waiter to the next set
+    event.reset();
+    bool set = false;
+    Thread waiter([&](){ set = event.wait_for(seconds(10)); });
+    this_thread::sleep(20);
+    event.reset();
+    event.set();
+    waiter.join();
+    EXPECT_TRUE(set);
+}
+
+// ===========
+// >> Latch
+// ===========
+TEST(Latch, CountDown) {
+    EXPECT_THROW(Latch(-1), std::system_error);
+    EXPECT_THROW(Latch(Latch::max() + 1), std::system_error);
+    EXPECT_TRUE(Latch(0).try_wait());
+
+    Latch latch(3);
+    EXPECT_FALSE(latch.try_wait());
+    EXPECT_FALSE(latch.wait_for(milliseconds(1)));
+    latch.count_down(2);
+    EXPECT_THROW(latch.count_down(2), std::system_error);
+    EXPECT_FALSE(latch.try_wait());
+    latch.count_down();
+    EXPECT_TRUE(latch.try_wait());
+    latch.wait();
+    EXPECT_TRUE(latch.wait_until(steady_clock::now()));
+}
+
+TEST(Latch, StartGate) {
+    constexpr int n = 4;
+    Latch ready(n + 1), done(n);
+    std::atomic<int> started{0};
+    std::vector<Thread> threads;
+    for ( int i = 0; i < n; i++ )
+        threads.emplace_back([&](){
+            ready.arrive_and_wait();
+            started++;
+            done.count_down();
+        });
+
+    this_thread::sleep(20);
+    EXPECT_EQ(started, 0);
+    ready.count_down();
+    done.wait();
+    EXPECT_EQ(started, n);
+}
+
+// =============
+// >> Barrier
+// =============
+TEST(Barrier, Phases) {
+    EXPECT_THROW(Barrier<>(-1), std::system_error);
+
+    constexpr int n = 4, phases = 200;
+    int completions = 0;
+    std::atomic<int> arrived{0};
+    bool in_step = true;
+    Barrier barrier(n, [&]() noexcept {
+        in_step = in_step && arrived == n * (completions + 1);
+        completions++;
+    });
+
+    std::vector<Thread> threads;
+    for ( int i = 0; i < n; i++ )
+        threads.emplace_back([&](){
+            for ( int p = 0; p < phases; p++ ) {
+                arrived++;
+                barrier.arrive_and_wait();
+            }
+        });
+    for ( Thread& thread : threads )
+        thread.join();
+    EXPECT_EQ(completions, phases);
+    EXPECT_TRUE(in_step);
+}
+
+TEST(Barrier, ArriveAndDrop) {
+    Barrier<> barrier(3);
+    auto token = barrier.arrive(2);
+    EXPECT_THROW((void) barrier.arrive(2), std::system_error);
+    barrier.arrive_and_drop();
+    barrier.wait(std::move(token));
+
+    // Only two arrivals per phase from now on
+    (void) barrier.arrive();
+    barrier.arrive_and_wait();
+
+    // Dropping below no threads at all is refused
+    Barrier<> empty(0);
+    EXPECT_THROW(empty.arrive_and_drop(), std::system_error);
+}
+
+// ===================
+// >> AdaptiveMutex
+// ===================
+TEST(AdaptiveMutex, Basic) {
+    AdaptiveMutex mutex;
+    EXPECT_TRUE(mutex.try_lock());
+    EXPECT_FALSE(mutex.try_lock());
+    mutex.unlock();
+    {
+        std::lock_guard<AdaptiveMutex> lock(mutex);
+        EXPECT_FALSE(mutex.try_lock());
+    }
+    EXPECT_TRUE(mutex.try_lock());
+    mutex.unlock();
+    this_thread::relax();
+}
+
+TEST(AdaptiveMutex, Contended) {
+    constexpr int n = 4, increments = 20000;
+    for ( auto spin : {AdaptiveMutex::default_spin, nanoseconds(0)} ) {
+        AdaptiveMutex mutex(spin);
+        long long counter = 0;
+        std::vector<Thread> threads;
+        for ( int i = 0; i < n; i++ )
+            threads.emplace_back([&](){
+                for ( int j = 0; j < increments; j++ ) {
+                    std::lock_guard<AdaptiveMutex> lock(mutex);
+                    counter++;
+                }
+            });
+        for ( Thread& thread : threads )
+            thread.join();
+        EXPECT_EQ(counter, (long long) n * increments);
+    }
+}
+
+// =================
+// >> Stop Tokens
+// =================
+#if SIMPLY_std20plus
+    TEST(Sync, StopToken) {
+        Event event;
+        Latch latch(1);
+        Barrier<> barrier(2);
+        bool woken[3] = {true, true, true};
+        Thread t0([&](std::stop_token token){ woken[0] = event.wait(token); });
+        Thread t1([&](std::stop_token token){ woken[1] = latch.wait(token); });
+        Thread t2([&](std::stop_token token){ woken[2] = barrier.arrive_and_wait(token); });
+
+        this_thread::sleep(20);
+        t0.join();
+        t1.join();
+        t2.join();
+        EXPECT_FALSE(woken[0]);
+        EXPECT_FALSE(woken[1]);
+        EXPECT_FALSE(woken[2]);
+
+        std::stop_source source;
+        event.set();
+        EXPECT_TRUE(event.wait(source.get_token()));
+        source.request_stop();
+        EXPECT_TRUE(event.wait(source.get_token()));
+        EXPECT_FALSE(latch.wait(source.get_token()));
+    }
+#endif
@@ -0,0 +1,170 @@
+/**
+ * @file 07_queue.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for `SpscQueue` and `MpmcQueue` from `simply-threading`
+ */
+#include <simply/queue.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace simply;
+
+// ===============
+// >> SpscQueue
+// ===============
+TEST(SpscQueue, Basic) {
+    SpscQueue<std::string, 4> queue;
+    EXPECT_EQ(queue.capacity(), 4u);
+    EXPECT_TRUE(queue.empty());
+
+    std::string out;
+    EXPECT_FALSE(queue.try_pop(out));
+    EXPECT_TRUE(queue.try_push("a"));
+    EXPECT_TRUE(queue.try_emplace(3, 'b'));
+    EXPECT_TRUE(queue.try_push(std::string("c")));
+    EXPECT_TRUE(queue.try_push("d"));
+    EXPECT_FALSE(queue.try_push("e"));
+    EXPECT_EQ(queue.size(), 4u);
+
+    EXPECT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_EQ(queue.pop(), "bbb");
+
+    // Destroys the rest
+    std::shared_ptr<int> counted = std::make_shared<int>(0);
+    {
+        SpscQueue<std::shared_ptr<int>, 2> owning;
+        owning.push(counted);
+        EXPECT_EQ(counted.use_count(), 2);
+    }
+    EXPECT_EQ(counted.use_count(), 1);
+}
+
+TEST(SpscQueue, Batches) {
+    SpscQueue<int, 8> queue;
+    std::vector<int> in = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(queue.try_push_n(in.begin(), in.size()), 8u);
+    EXPECT_EQ(queue.try_push_n(in.begin(), 1), 0u);
+
+    std::vector<int> out;
+    EXPECT_EQ(queue.try_pop_n(std::back_inserter(out), 5), 5u);
+    EXPECT_EQ(queue.try_push_n(in.begin() + 8, 2), 2u);
+    EXPECT_EQ(queue.pop_n(std::back_inserter(out), 100), 5u);
+    EXPECT_EQ(out, in);
+}
+
+TEST(SpscQueue, Pipeline) {
+    constexpr int n = 100000;
+    SpscQueue<int, 64> queue;
+    long long sum = 0;
+    bool in_order = true;
+    Thread consumer([&](){
+        int expected = 0;
+        while ( expected < n ) {
+            int batch[16];
+            int* end = batch;
+            end += queue.pop_n(batch, 16);
+            for ( int* it = batch; it != end; ++it ) {
+                in_order = in_order && *it == expected++;
+                sum += *it;
+            }
+        }
+    });
+    for ( int i = 0; i < n; i++ )
+        queue.push(i);
+    consumer.join();
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(sum, (long long) n * (n - 1) / 2);
+}
+
+// ===============
+// >> MpmcQueue
+// ===============
+TEST(MpmcQueue, Basic) {
+    EXPECT_THROW(MpmcQueue<int>(0), std::system_error);
+    EXPECT_EQ(MpmcQueue<int>(1).capacity(), 2u);
+    EXPECT_EQ(MpmcQueue<int>(5).capacity(), 8u);
+
+    MpmcQueue<std::unique_ptr<int>> queue(2);
+    EXPECT_TRUE(queue.try_push(std::make_unique<int>(1)));
+    EXPECT_TRUE(queue.try_emplace(new int(2)));
+    EXPECT_FALSE(queue.try_push(std::make_unique<int>(3)));
+    EXPECT_EQ(queue.size(), 2u);
+
+    std::unique_ptr<int> out;
+    EXPECT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(*out, 1);
+    EXPECT_EQ(*queue.pop(), 2);
+    EXPECT_FALSE(queue.try_pop(out));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcQueue, ManyToMany) {
+    constexpr int producers = 3, consumers = 3, n = 20000;
+    MpmcQueue<int> queue(128);
+    std::atomic<long long> sum{0};
+    std::atomic<int> popped{0};
+
+    std::vector<Thread> threads;
+    for ( int c = 0; c < consumers; c++ )
+        threads.emplace_back([&](){
+            int batch[8];
+            while ( popped < producers * n ) {
+                size_t got = queue.try_pop_n(batch, 8);
+                for ( size_t i = 0; i < got; i++ )
+                    sum += batch[i];
+                popped += static_cast<int>(got);
+                if ( !got )
+                    this_thread::yield();
+            }
+        });
+    for ( int p = 0; p < producers; p++ )
+        threads.emplace_back([&](){
+            for ( int i = 1; i <= n; i++ )
+                queue.push(i);
+        });
+    for ( Thread& thread : threads )
+        thread.join();
+    EXPECT_EQ(popped, producers * n);
+    EXPECT_EQ(sum, (long long) producers * n * (n + 1) / 2);
+}
+
+// =================
+// >> Stop Tokens
+// =================
+#if SIMPLY_std20plus
+    TEST(Queue, StopToken) {
+        SpscQueue<int, 2> spsc;
+        MpmcQueue<int> mpmc(2);
+        bool popped = true, pushed = true;
+        Thread consumer([&](std::stop_token token){ popped = spsc.pop(token).has_value(); });
+        Thread producer([&](std::stop_token token){
+            mpmc.push(1);
+            mpmc.push(2);
+            pushed = mpmc.push(3, token);
+        });
+        this_thread::sleep(20);
+        consumer.join();
+        producer.join();
+        EXPECT_FALSE(popped);
+        EXPECT_FALSE(pushed);
+        EXPECT_EQ(mpmc.size(), 2u);
+
+        std::stop_source source;
+        source.request_stop();
+        int out[2];
+        EXPECT_EQ(*mpmc.pop(source.get_token()), 1);
+        EXPECT_EQ(mpmc.pop_n(out, 2, source.get_token()), 1u);
+        EXPECT_EQ(mpmc.pop_n(out, 2, source.get_token()), 0u);
+    }
+#endif
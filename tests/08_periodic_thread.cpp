@@ -0,0 +1,108 @@
+/**
+ * @file 08_periodic_thread.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `PeriodicThread` from `simply-threading`
+ */
+#include <simply/periodic_thread.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <system_error>
+
+using namespace simply;
+using namespace std::chrono;
+
+// ===================
+// >> PeriodicThread
+// ===================
+TEST(PeriodicThread, Null) {
+    PeriodicThread periodic;
+    EXPECT_FALSE(periodic.joinable());
+    EXPECT_FALSE(periodic.request_stop());
+    EXPECT_EQ(periodic.stats().ticks, 0u);
+    EXPECT_THROW(PeriodicThread(nanoseconds(0), [](){}), std::system_error);
+}
+
+TEST(PeriodicThread, Rate) {
+    std::atomic<int> ticks{0};
+    auto start = steady_clock::now();
+    PeriodicThread periodic(milliseconds(5), [&ticks](){ ticks++; });
+    EXPECT_EQ(periodic.period(), milliseconds(5));
+    this_thread::sleep(100);
+    periodic.join();
+    auto elapsed = steady_clock::now() - start;
+
+    // Loose, as the tests share the CPUs - bounded by how long it really ran, as the sleep may overrun
+    PeriodicThread::Stats stats = periodic.stats();
+    EXPECT_EQ(stats.ticks, static_cast<uint64_t>(ticks));
+    EXPECT_GE(ticks, 5);
+    EXPECT_LE(ticks, elapsed / milliseconds(5) + 2);
+    EXPECT_GE(stats.max_lateness, stats.mean_lateness);
+    EXPECT_GE(stats.mean_lateness.count(), 0);
+}
+
+TEST(PeriodicThread, ReturnFalseStops) {
+    int ticks = 0;
+    PeriodicThread periodic(microseconds(100), [&ticks](int limit){ return ++ticks < limit; }, 3);
+    // Join would stop it, so wait for the loop to end by itself
+    while ( periodic.stats().ticks < 3 )
+        this_thread::sleep(1);
+    this_thread::sleep(5);
+    periodic.join();
+    EXPECT_EQ(ticks, 3);
+    EXPECT_EQ(periodic.stats().ticks, 3u);
+}
+
+TEST(PeriodicThread, Overruns) {
+    auto slow = [](){ this_thread::sleep(5); };
+    PeriodicThread skipping(milliseconds(2), PeriodicThread::SKIP, slow);
+    PeriodicThread catching_up(Thread::Attributes().name("catch_up"), milliseconds(2), PeriodicThread::CATCH_UP, slow);
+    this_thread::sleep(50);
+    skipping.join();
+    catching_up.join();
+
+    PeriodicThread::Stats skipped = skipping.stats();
+    EXPECT_GT(skipped.overruns, 0u);
+    EXPECT_GT(skipped.skipped, 0u);
+    PeriodicThread::Stats caught_up = catching_up.stats();
+    EXPECT_GT(caught_up.overruns, 0u);
+    EXPECT_EQ(caught_up.skipped, 0u);
+    // Catching up runs late ticks straight away, starting ever later
+    EXPECT_GT(caught_up.max_lateness, milliseconds(2));
+}
+
+TEST(PeriodicThread, StopsPromptly) {
+    std::atomic<int> ticks{0};
+    PeriodicThread periodic(hours(1), [&ticks](){ ticks++; });
+    while ( ticks == 0 )
+        this_thread::sleep(1);
+
+    auto begin = steady_clock::now();
+    EXPECT_TRUE(periodic.request_stop());
+    EXPECT_FALSE(periodic.request_stop());
+    periodic.join();
+    EXPECT_LT(steady_clock::now() - begin, seconds(5));
+    EXPECT_EQ(ticks, 1);
+
+    // Moving in stops the old loop
+    periodic = PeriodicThread(hours(1), [](){});
+    periodic = PeriodicThread();
+    EXPECT_FALSE(periodic.joinable());
+}
+
+#if SIMPLY_std20plus
+    TEST(PeriodicThread, StopToken) {
+        bool stopped = false;
+        {
+            PeriodicThread periodic(milliseconds(1), [&stopped](std::stop_token token){ stopped = token.stop_requested(); });
+            this_thread::sleep(10);
+        }
+        EXPECT_FALSE(stopped);
+    }
+#endif
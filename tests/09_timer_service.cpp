@@ -0,0 +1,169 @@
+/**
+ * @file 09_timer_service.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `TimerService` from `simply-threading`
+ */
+#include <simply/timer_service.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+using namespace simply;
+using namespace std::chrono;
+
+// Polls until `count` reaches `n`, or a generous timeout
+static bool wait_for_count(const std::atomic<int>& count, int n) {
+    auto deadline = steady_clock::now() + seconds(10);
+    while ( count.load() < n && steady_clock::now() < deadline )
+        this_thread::sleep(1);
+    return count.load() >= n;
+}
+
+// =================
+// >> TimerService
+// =================
+TEST(TimerService, Invalid) {
+    EXPECT_THROW(TimerService("timers", nanoseconds(0)), std::system_error);
+
+    TimerService timers;
+    EXPECT_EQ(timers.resolution(), TimerService::default_resolution);
+    EXPECT_THROW(timers.schedule_after(milliseconds(-1), [](){}), std::system_error);
+    EXPECT_THROW(timers.schedule_every(nanoseconds(0), [](){}), std::system_error);
+    EXPECT_FALSE(timers.cancel(0));
+    EXPECT_EQ(timers.size(), 0u);
+}
+
+TEST(TimerService, Order) {
+    std::mutex mutex;
+    std::vector<int> order;
+    std::atomic<int> fired{0};
+    bool early = false;
+    TimerService timers;
+    for ( int ms : {20, 5, 15, 10, 1} ) {
+        auto deadline = steady_clock::now() + milliseconds(ms);
+        timers.schedule_at(deadline, [&, ms, deadline](){
+            std::lock_guard<std::mutex> lock(mutex);
+            early |= steady_clock::now() < deadline;
+            order.push_back(ms);
+            fired++;
+        });
+    }
+    EXPECT_EQ(timers.size(), 5u);
+    ASSERT_TRUE(wait_for_count(fired, 5));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(order, (std::vector<int>{1, 5, 10, 15, 20}));
+    EXPECT_FALSE(early);
+    EXPECT_EQ(timers.size(), 0u);
+}
+
+TEST(TimerService, Cancel) {
+    std::atomic<int> fired{0};
+    TimerService timers;
+    TimerService::id_type id = timers.schedule_after(milliseconds(20), [&fired](){ fired++; });
+    EXPECT_NE(id, 0u);
+    EXPECT_TRUE(timers.cancel(id));
+    EXPECT_FALSE(timers.cancel(id));
+    EXPECT_EQ(timers.size(), 0u);
+
+    // The freed slot is reused, but not the id
+    TimerService::id_type reused = timers.schedule_after(milliseconds(1), [&fired](){ fired += 10; });
+    EXPECT_NE(reused, id);
+    EXPECT_FALSE(timers.cancel(id));
+    ASSERT_TRUE(wait_for_count(fired, 10));
+    EXPECT_FALSE(timers.cancel(reused));
+
+    this_thread::sleep(40);
+    EXPECT_EQ(fired, 10);
+}
+
+TEST(TimerService, Past) {
+    std::atomic<int> fired{0};
+    TimerService timers;
+    // Put the thread to sleep on a far timer first
+    timers.schedule_after(hours(1), [](){});
+    this_thread::sleep(5);
+
+    auto begin = steady_clock::now();
+    timers.schedule_at(begin - seconds(1), [&fired](){ fired++; });
+    ASSERT_TRUE(wait_for_count(fired, 1));
+    EXPECT_LT(steady_clock::now() - begin, milliseconds(500));
+    EXPECT_EQ(timers.size(), 1u);
+}
+
+TEST(TimerService, Cascade) {
+    // 30ms of 1us ticks is three levels up the wheel
+    std::atomic<int> fired{0};
+    bool early = false;
+    TimerService timers("timers", microseconds(1));
+    auto deadline = steady_clock::now() + milliseconds(30);
+    timers.schedule_at(deadline, [&](){
+        early = steady_clock::now() < deadline;
+        fired++;
+    });
+    ASSERT_TRUE(wait_for_count(fired, 1));
+    EXPECT_FALSE(early);
+}
+
+TEST(TimerService, Every) {
+    std::atomic<int> fired{0};
+    TimerService timers;
+    TimerService::id_type id = timers.schedule_every(milliseconds(5), [&fired](){ fired++; });
+    ASSERT_TRUE(wait_for_count(fired, 3));
+    EXPECT_EQ(timers.size(), 1u);
+    EXPECT_TRUE(timers.cancel(id));
+    EXPECT_FALSE(timers.cancel(id));
+
+    int after = fired;
+    this_thread::sleep(20);
+    EXPECT_EQ(fired, after);
+}
+
+TEST(TimerService, Many) {
+    constexpr int n = 100000;
+    std::atomic<int> fired{0};
+    TimerService timers("timers", microseconds(10));
+    std::vector<TimerService::id_type> ids;
+    ids.reserve(n);
+    // Those cancelled are armed hours out, so none can fire first however slow arming is
+    auto now = steady_clock::now();
+    for ( int i = 0; i < n; i++ ) {
+        auto due = (i % 2 ? milliseconds(500) : hours(2)) + microseconds((i * 7919) % 20000);
+        ids.push_back(timers.schedule_at(now + due, [&fired](){ fired++; }));
+    }
+    for ( int i = 0; i < n; i += 2 )
+        EXPECT_TRUE(timers.cancel(ids[i]));
+
+    ASSERT_TRUE(wait_for_count(fired, n / 2));
+    this_thread::sleep(5);
+    EXPECT_EQ(fired, n / 2);
+    EXPECT_EQ(timers.size(), 0u);
+}
+
+TEST(TimerService, Pool) {
+    constexpr int n = 1000;
+    std::atomic<int> fired{0};
+    std::atomic<int> on_pool{0};
+    ThreadPool pool(2);
+    {
+        TimerService timers(pool);
+        auto deadline = steady_clock::now() + milliseconds(5);
+        for ( int i = 0; i < n; i++ )
+            timers.schedule_at(deadline, [&](){
+                on_pool += ThreadPool::current() == &pool;
+                fired++;
+            });
+        ASSERT_TRUE(wait_for_count(fired, n));
+    }
+    pool.wait_idle();
+    EXPECT_EQ(on_pool, n);
+}
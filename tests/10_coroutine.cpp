@@ -0,0 +1,118 @@
+/**
+ * @file 10_coroutine.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for `Task` and the coroutine awaitables from `simply-threading` - C++ 20 only
+ */
+#include <simply/coroutine.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <stop_token>
+
+using namespace simply;
+using namespace std::chrono;
+
+// =========
+// >> Task
+// =========
+static Task<int> answer() {
+    co_return 42;
+}
+
+static Task<int> twice() {
+    int a = co_await answer();
+    int b = co_await answer();
+    co_return a + b;
+}
+
+static Task<> fails() {
+    throw std::runtime_error("fails");
+    co_return;
+}
+
+TEST(Task, SyncWait) {
+    EXPECT_EQ(sync_wait(answer()), 42);
+    EXPECT_EQ(sync_wait(twice()), 84);
+    EXPECT_THROW(sync_wait(fails()), std::runtime_error);
+    EXPECT_THROW(sync_wait(Task<int>()), std::system_error);
+
+    Task<int> lazy = answer();
+    EXPECT_TRUE(lazy.valid());
+    EXPECT_FALSE(lazy.done());
+}
+
+TEST(Task, ResumeOn) {
+    ThreadPool pool(2);
+    auto task = [](ThreadPool& pool) -> Task<bool> {
+        bool before = ThreadPool::current() == &pool;
+        co_await resume_on(pool);
+        co_return !before && ThreadPool::current() == &pool;
+    };
+    EXPECT_TRUE(sync_wait(task(pool)));
+}
+
+TEST(Task, Sleep) {
+    auto task = []() -> Task<nanoseconds> {
+        auto begin = steady_clock::now();
+        bool slept = co_await sleep_for(milliseconds(5));
+        EXPECT_TRUE(slept);
+        co_return steady_clock::now() - begin;
+    };
+    EXPECT_GE(sync_wait(task()), milliseconds(5));
+    EXPECT_THROW(sleep_for(milliseconds(-1)), std::system_error);
+
+    // Sleeping from a pool resumes on it
+    ThreadPool pool(1);
+    TimerService timers;
+    auto on_pool = [](ThreadPool& pool, TimerService& timers) -> Task<bool> {
+        co_await resume_on(pool);
+        co_await sleep_until(timers, steady_clock::now() + milliseconds(1));
+        co_return ThreadPool::current() == &pool;
+    };
+    EXPECT_TRUE(sync_wait(on_pool(pool, timers)));
+}
+
+static Task<bool> sleep_long() {
+    co_return co_await sleep_for(hours(1));
+}
+
+TEST(Task, StopToken) {
+    std::stop_source source;
+    auto task = []() -> Task<bool> {
+        std::stop_token token = co_await this_task::get_stop_token();
+        EXPECT_TRUE(token.stop_possible());
+        // The nested Task inherits the token
+        co_return co_await sleep_long();
+    };
+    Thread stopper([&source](){
+        this_thread::sleep(10);
+        source.request_stop();
+    });
+    auto begin = steady_clock::now();
+    EXPECT_FALSE(sync_wait(task(), source.get_token()));
+    EXPECT_LT(steady_clock::now() - begin, seconds(5));
+
+    // Already stopped, so doesn't suspend at all
+    EXPECT_FALSE(sync_wait(sleep_long(), source.get_token()));
+}
+
+TEST(Task, Spawn) {
+    constexpr int n = 10000;
+    ThreadPool pool(2);
+    Latch finished(n);
+    auto task = [](ThreadPool& pool, Latch& finished, int i) -> Task<> {
+        co_await resume_on(pool);
+        co_await sleep_for(microseconds(i % 1000));
+        finished.count_down();
+    };
+    for ( int i = 0; i < n; i++ )
+        spawn(task(pool, finished, i));
+    EXPECT_TRUE(finished.wait_for(seconds(10)));
+}
@@ -0,0 +1,127 @@
+/**
+ * @file 11_arena.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `Arena`, and per-thread arenas, from `simply-threading`
+ */
+#include <simply/threading.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace simply;
+
+// ==========
+// >> Arena
+// ==========
+TEST(Arena, Allocate) {
+    Arena arena(4096);
+    EXPECT_EQ(arena.reserved(), 0u);
+
+    void* a = arena.allocate(24);
+    void* b = arena.allocate(24);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 16, 0u);
+    EXPECT_EQ(arena.used(), 64u);
+    EXPECT_EQ(arena.reserved(), 4096u);
+
+    void* wide = arena.allocate(1000, 256);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(wide) % 256, 0u);
+
+    // Bigger than a quarter block gets a block of its own
+    void* big = arena.allocate(10000);
+    EXPECT_NE(big, nullptr);
+    EXPECT_GE(arena.reserved(), 4096u + 10000u);
+}
+
+TEST(Arena, Reuse) {
+    Arena arena;
+    void* small = arena.allocate(40);
+    arena.deallocate(small, 40);
+    // Same size class
+    EXPECT_EQ(arena.allocate(33), small);
+    EXPECT_NE(arena.allocate(33), small);
+
+    // Larger ones only if freed last
+    void* large = arena.allocate(1000);
+    arena.deallocate(large, 1000);
+    EXPECT_EQ(arena.allocate(1000), large);
+}
+
+TEST(Arena, Reset) {
+    Arena arena(4096);
+    for ( int i = 0; i < 200; i++ )
+        arena.allocate(64);
+    arena.allocate(20000);
+    size_t reserved = arena.reserved();
+    EXPECT_GT(reserved, 4096u + 20000u);
+
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0u);
+    // The full-sized blocks are kept, the oversized one is freed
+    EXPECT_LT(arena.reserved(), reserved);
+    EXPECT_GT(arena.reserved(), 0u);
+    void* again = arena.allocate(64);
+    EXPECT_NE(again, nullptr);
+    size_t kept = arena.reserved();
+    for ( int i = 0; i < 200; i++ )
+        arena.allocate(64);
+    EXPECT_EQ(arena.reserved(), kept);
+}
+
+TEST(Arena, Resource) {
+    Arena arena;
+    std::pmr::memory_resource* resource = &arena.resource();
+    EXPECT_EQ(&arena.resource().arena(), &arena);
+    EXPECT_TRUE(resource->is_equal(arena.resource()));
+
+    std::pmr::vector<std::pmr::string> strings(resource);
+    for ( int i = 0; i < 1000; i++ )
+        strings.emplace_back(std::string(50, 'x') + std::to_string(i));
+    EXPECT_EQ(std::string(strings[999]), std::string(50, 'x') + "999");
+    EXPECT_GT(arena.used(), 1000u * 50u);
+}
+
+TEST(Arena, Thread) {
+    EXPECT_EQ(this_thread::arena(), nullptr);
+    EXPECT_EQ(Thread::Attributes().arena(), 0u);
+    EXPECT_EQ(Thread::Attributes().arena(Arena::default_block_size).arena(), Arena::default_block_size);
+
+    Arena* seen = nullptr;
+    size_t block_size = 0;
+    Thread([&seen, &block_size](){
+        seen = this_thread::arena();
+        if ( seen ) {
+            block_size = seen->block_size();
+            std::pmr::vector<int> values(&seen->resource());
+            values.assign(100, 7);
+        }
+    });
+    EXPECT_EQ(seen, nullptr);
+
+    Thread(Thread::Attributes().arena(8192), [&seen, &block_size](){
+        seen = this_thread::arena();
+        if ( seen ) {
+            block_size = seen->block_size();
+            std::pmr::vector<int> values(&seen->resource());
+            values.assign(100, 7);
+        }
+    });
+    EXPECT_NE(seen, nullptr);
+    EXPECT_EQ(block_size, 8192u);
+
+    // Also with a payload too big to start inline
+    std::vector<int> big(1000, 1);
+    bool had_arena = false;
+    Thread(Thread::Attributes().arena(Arena::default_block_size), [&had_arena](std::vector<int> values){
+        had_arena = this_thread::arena() && values.size() == 1000;
+    }, big);
+    EXPECT_TRUE(had_arena);
+}
@@ -0,0 +1,149 @@
+/**
+ * @file 12_parallel.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for `parallel_for`, `parallel_reduce` and `parallel_transform` from `simply-threading`
+ */
+#include <simply/parallel.h>
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace simply;
+
+// =================
+// >> parallel_for
+// =================
+TEST(ParallelFor, Range) {
+    ThreadPool pool(4);
+    for ( size_t grain : {0, 1, 7, 1000, 100000} ) {
+        std::vector<std::atomic<int>> hits(10007);
+        EXPECT_TRUE(parallel_for(pool, size_t(0), hits.size(), grain, [&hits](size_t i){
+            hits[i].fetch_add(1, std::memory_order_relaxed);
+        }));
+        for ( auto& hit : hits )
+            ASSERT_EQ(hit.load(), 1);
+    }
+
+    // Signed, offset and empty ranges
+    std::atomic<int64_t> sum{0};
+    EXPECT_TRUE(parallel_for(pool, -50, 50, 3, [&sum](int i){ sum += i; }));
+    EXPECT_EQ(sum.load(), -50);
+    EXPECT_TRUE(parallel_for(pool, 5, 5, 1, [](int){ FAIL(); }));
+    EXPECT_TRUE(parallel_for(pool, 5, 0, 1, [](int){ FAIL(); }));
+
+    // The shared pool
+    std::atomic<int> count{0};
+    EXPECT_TRUE(parallel_for(0, 1000, 0, [&count](int){ count++; }));
+    EXPECT_EQ(count.load(), 1000);
+}
+
+TEST(ParallelFor, Placement) {
+    constexpr size_t n = 4096;
+    ThreadPool pool(1);
+    std::vector<size_t> owners(n);
+    parallel_for(pool, size_t(0), n, 16, [&owners](size_t i){
+        this_thread::relax();
+        owners[i] = ThreadPool::current() ? ThreadPool::current_index() : SIZE_MAX;
+    });
+
+    // The worker runs its shard from the front, the caller steals from the back
+    auto split = std::find(owners.begin(), owners.end(), SIZE_MAX);
+    EXPECT_TRUE(std::all_of(owners.begin(), split, [](size_t owner){ return owner == 0; }));
+    EXPECT_TRUE(std::all_of(split, owners.end(), [](size_t owner){ return owner == SIZE_MAX; }));
+}
+
+TEST(ParallelFor, Nested) {
+    ThreadPool pool(2);
+    std::atomic<int> count{0};
+    parallel_for(pool, 0, 8, 1, [&pool, &count](int){
+        parallel_for(pool, 0, 100, 10, [&count](int){ count++; });
+    });
+    EXPECT_EQ(count.load(), 800);
+}
+
+TEST(ParallelFor, Throws) {
+    ThreadPool pool(4);
+    std::atomic<int> ran{0};
+    EXPECT_THROW(parallel_for(pool, 0, 100000, 10, [&ran](int i){
+        ran++;
+        if ( i == 500 )
+            throw std::runtime_error("500");
+    }), std::runtime_error);
+    EXPECT_LT(ran.load(), 100000);
+
+    // The pool is fine afterwards
+    std::atomic<int> count{0};
+    EXPECT_TRUE(parallel_for(pool, 0, 100, 1, [&count](int){ count++; }));
+    EXPECT_EQ(count.load(), 100);
+}
+
+#if SIMPLY_std20plus
+    TEST(ParallelFor, StopToken) {
+        ThreadPool pool(4);
+        std::stop_source source;
+        std::atomic<int> ran{0};
+        EXPECT_FALSE(parallel_for(pool, 0, 100000, 10, [&source, &ran](int i){
+            ran++;
+            if ( i == 100 )
+                source.request_stop();
+        }, source.get_token()));
+        EXPECT_LT(ran.load(), 100000);
+
+        // Already stopped
+        EXPECT_FALSE(parallel_for(pool, 0, 10, 1, [](int){ FAIL(); }, source.get_token()));
+    }
+#endif
+
+// ====================
+// >> parallel_reduce
+// ====================
+TEST(ParallelReduce, Sum) {
+    ThreadPool pool(4);
+    for ( size_t grain : {0, 1, 13, 1000000} ) {
+        int64_t sum = parallel_reduce(pool, int64_t(1), int64_t(100001), grain, int64_t(0),
+            [](int64_t i){ return i; },
+            [](int64_t a, int64_t b){ return a + b; }
+        );
+        EXPECT_EQ(sum, int64_t(100000) * 100001 / 2);
+    }
+
+    // Moves non-trivial values, and the empty range gives the identity
+    std::vector<int> all = parallel_reduce(pool, 0, 1000, 10, std::vector<int>(),
+        [](int i){ return std::vector<int>{i}; },
+        [](std::vector<int> a, std::vector<int> b){
+            a.insert(a.end(), b.begin(), b.end());
+            return a;
+        }
+    );
+    std::sort(all.begin(), all.end());
+    std::vector<int> expected(1000);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(all, expected);
+    EXPECT_EQ(parallel_reduce(0, 0, 1, 7, [](int){ return 1; }, [](int a, int b){ return a + b; }), 7);
+}
+
+// =======================
+// >> parallel_transform
+// =======================
+TEST(ParallelTransform, Squares) {
+    ThreadPool pool(3);
+    std::vector<int> in(50000);
+    std::iota(in.begin(), in.end(), 0);
+    std::vector<int64_t> out(in.size());
+    EXPECT_TRUE(parallel_transform(pool, in.begin(), in.end(), out.begin(), 100, [](int x){ return int64_t(x) * x; }));
+    for ( size_t i = 0; i < in.size(); i++ )
+        ASSERT_EQ(out[i], int64_t(i) * int64_t(i));
+
+    EXPECT_TRUE(parallel_transform(in.data(), in.data() + in.size(), in.data(), 0, [](int x){ return -x; }));
+    EXPECT_EQ(in[49999], -49999);
+}
@@ -0,0 +1,106 @@
+/**
+ * @file 13_thread_group.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `ThreadGroup` from `simply-threading`
+ */
+#include <simply/thread_group.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace simply;
+using namespace std::chrono;
+
+// ================
+// >> ThreadGroup
+// ================
+TEST(ThreadGroup, Spawn) {
+    std::vector<std::atomic<int>> hits(16);
+    {
+        ThreadGroup group(16, Thread::Attributes(), [&hits](size_t index, int add){
+            hits[index] += add;
+        }, 2);
+        EXPECT_EQ(group.size(), 16u);
+        group.spawn(4, [&hits](){ hits[0]++; });
+        EXPECT_EQ(group.size(), 20u);
+    }
+    EXPECT_EQ(hits[0].load(), 6);
+    for ( size_t i = 1; i < hits.size(); i++ )
+        EXPECT_EQ(hits[i].load(), 2);
+}
+
+TEST(ThreadGroup, Names) {
+    ThreadGroup group(Thread::Attributes().name("decoder"));
+    std::atomic<bool> release{false};
+    group.spawn(3, [&release](){
+        while ( !release )
+            this_thread::sleep(1);
+    });
+    EXPECT_EQ(group[0].get_name(), "decoder_0");
+    EXPECT_EQ(group[2].get_name(), "decoder_2");
+    EXPECT_THROW(group[3], std::system_error);
+    release = true;
+}
+
+TEST(ThreadGroup, JoinAll) {
+    ThreadGroup group;
+    std::atomic<bool> release{false};
+    group.spawn(8, [&release](){
+        while ( !release )
+            this_thread::sleep(1);
+    });
+    EXPECT_EQ(group.running(), 8u);
+    EXPECT_FALSE(group.join_all_for(milliseconds(20)));
+    EXPECT_EQ(group.size(), 8u);
+
+    release = true;
+    EXPECT_TRUE(group.join_all_until(system_clock::now() + seconds(10)));
+    EXPECT_EQ(group.size(), 0u);
+    EXPECT_EQ(group.running(), 0u);
+
+    // Reusable once joined
+    std::atomic<int> count{0};
+    group.spawn(4, [&count](){ count++; });
+    group.join_all();
+    EXPECT_EQ(count.load(), 4);
+}
+
+#if SIMPLY_std20plus
+    TEST(ThreadGroup, StopAll) {
+        constexpr int n = 64;
+        constexpr auto shutdown = milliseconds(20);
+        std::atomic<int> stopped{0};
+        ThreadGroup group(n, Thread::Attributes(), [&stopped, shutdown](std::stop_token token, size_t){
+            while ( !token.stop_requested() )
+                this_thread::sleep(1);
+            // Each takes a while to shut down, all at the same time
+            this_thread::sleep_for(shutdown);
+            stopped++;
+        });
+        EXPECT_TRUE(group.get_stop_token().stop_possible());
+
+        auto begin = steady_clock::now();
+        group.join_all();
+        EXPECT_EQ(stopped.load(), n);
+        EXPECT_LT(steady_clock::now() - begin, shutdown * n / 4);
+
+        // A fresh stop source for the next threads
+        EXPECT_FALSE(group.get_stop_token().stop_requested());
+        std::atomic<bool> ran{false};
+        group.spawn(1, [&ran](std::stop_token token){
+            while ( !token.stop_requested() )
+                this_thread::sleep(1);
+            ran = true;
+        });
+        group.join_all();
+        EXPECT_TRUE(ran);
+    }
+#endif
@@ -0,0 +1,93 @@
+/**
+ * @file 14_per_thread.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `PerThread` from `simply-threading`
+ */
+#include <simply/per_thread.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace simply;
+
+// ==============
+// >> PerThread
+// ==============
+TEST(PerThread, Local) {
+    PerThread<int> values;
+    int& mine = values.local();
+    EXPECT_EQ(mine, 0);
+    mine = 7;
+    EXPECT_EQ(&values.local(), &mine);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&mine) % cache_line_size, 0u);
+
+    int* theirs = nullptr;
+    Thread([&values, &theirs](){
+        theirs = &values.local();
+        *theirs = 5;
+    });
+    EXPECT_NE(theirs, &mine);
+    EXPECT_EQ(values.size(), 2u);
+    EXPECT_EQ(values.combine(0, [](int total, int value){ return total + value; }), 12);
+
+    // Built on the thread that uses it
+    PerThread<std::vector<int>> lists([](){ return std::vector<int>(3, 1); });
+    EXPECT_EQ(lists.local().size(), 3u);
+}
+
+TEST(PerThread, Sum) {
+    constexpr int threads = 8;
+    constexpr uint64_t n = 100000;
+    PerThread<std::atomic<uint64_t>> counter;
+    std::atomic<bool> done{false};
+    {
+        std::vector<Thread> workers;
+        for ( int t = 0; t < threads; t++ )
+            workers.emplace_back([&counter](){
+                for ( uint64_t i = 0; i < n; i++ )
+                    counter.add(1);
+            });
+        // Reading while they count only ever sees a partial total
+        Thread reader([&counter, &done](){
+            uint64_t last = 0;
+            while ( !done ) {
+                uint64_t now = counter.sum();
+                EXPECT_GE(now, last);
+                EXPECT_LE(now, threads * n);
+                last = now;
+            }
+        });
+        for ( Thread& worker : workers )
+            worker.join();
+        done = true;
+    }
+    EXPECT_EQ(counter.sum(), threads * n);
+    EXPECT_LE(counter.size(), size_t(threads) + 1);
+}
+
+TEST(PerThread, Reuse) {
+    PerThread<std::atomic<uint64_t>> counter;
+    // One after another, so each takes the slot the last one gave back
+    for ( int t = 0; t < 10; t++ )
+        Thread([&counter](){ counter.add(3); });
+    EXPECT_EQ(counter.size(), 1u);
+    EXPECT_EQ(counter.sum(), 30u);
+
+    // Threads not started by simply::Thread give theirs back when they exit
+    std::set<const void*> slots;
+    counter.for_each([&slots](const std::atomic<uint64_t>& value){ slots.insert(&value); });
+    std::thread([&counter](){ counter.add(1); }).join();
+    std::thread([&counter](){ counter.add(1); }).join();
+    EXPECT_EQ(counter.size(), 1u);
+    EXPECT_EQ(counter.sum(), 32u);
+    counter.for_each([&slots](const std::atomic<uint64_t>& value){ EXPECT_EQ(slots.count(&value), 1u); });
+}
@@ -0,0 +1,89 @@
+/**
+ * @file 15_trace.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `Trace`, and the tracing hooks, from `simply-threading`
+ */
+#define SIMPLY_TRACE 1
+#include <simply/sync.h>
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+
+using namespace simply;
+
+static size_t count(const std::string& text, const std::string& what) {
+    size_t n = 0;
+    for ( size_t at = text.find(what); at != std::string::npos; at = text.find(what, at + 1) )
+        n++;
+    return n;
+}
+
+static std::string written() {
+    std::ostringstream out;
+    Trace::write(out);
+    return out.str();
+}
+
+// ==========
+// >> Trace
+// ==========
+TEST(Trace, Lifecycle) {
+    EXPECT_TRUE(Trace::enabled);
+    Trace::clear();
+
+    Event go;
+    Thread worker(Thread::Attributes().name("traced"), [&go](){
+        go.wait();
+        this_thread::sleep(2);
+        SIMPLY_TRACE_SCOPE("stage");
+        SIMPLY_TRACE_INSTANT("checkpoint");
+    });
+    this_thread::sleep(5);
+    go.set();
+    worker.join();
+
+    std::string json = written();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"name\":\"traced\""), std::string::npos);
+    EXPECT_EQ(count(json, "\"name\":\"spawn\""), 1u);
+    EXPECT_EQ(count(json, "\"name\":\"join\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"thread\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"sleep\""), 4u);
+    EXPECT_EQ(count(json, "\"name\":\"wait\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"stage\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"checkpoint\",\"cat\":\"simply\",\"ph\":\"i\""), 1u);
+    EXPECT_EQ(count(json, "{"), count(json, "}"));
+
+    // Renames reach the trace too
+    Event renamed, done;
+    Thread other([&renamed, &done](){
+        SIMPLY_TRACE_INSTANT("before");
+        renamed.wait();
+        done.set();
+    });
+    other.set_name("renamed");
+    renamed.set();
+    done.wait();
+    other.join();
+    EXPECT_NE(written().find("\"name\":\"renamed\""), std::string::npos);
+
+    Trace::clear();
+    EXPECT_EQ(count(written(), "\"ph\":\"B\""), 0u);
+}
+
+TEST(Trace, Overflow) {
+    Trace::clear();
+    Thread([](){
+        for ( size_t i = 0; i < 3 * Trace::buffer_events; i++ )
+            SIMPLY_TRACE_INSTANT("tick");
+    });
+    size_t ticks = count(written(), "\"name\":\"tick\"");
+    EXPECT_GT(ticks, Trace::buffer_events / 2);
+    EXPECT_LE(ticks, Trace::buffer_events);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file 16_realtime.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for `Thread::Attributes::prefault_stack`, `lock_memory` and fault counts from `simply-threading`
+ */
+#include <simply/threading.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <system_error>
+
+using namespace simply;
+
+// Sanitizers fault in shadow memory for whatever is touched, so the zero-fault checks only hold without them
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+    #define FAULT_FREE 0
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+        #define FAULT_FREE 0
+    #endif
+#endif
+#ifndef FAULT_FREE
+    #define FAULT_FREE SIMPLY_LINUX
+#endif
+
+// Writes `bytes` of fresh stack, as a deep call would
+SIMPLY_NOINLINE static void touch_stack(size_t bytes) {
+    volatile char frame[128 * 1024];
+    for ( size_t at = 0; at < bytes && at < sizeof(frame); at += 512 )
+        frame[at] = 1;
+}
+
+// Not being allowed to lock memory, e.g. by RLIMIT_MEMLOCK, is not a failure here
+static bool lock_refused(const std::system_error& e) {
+    return e.code() == std::errc::operation_not_permitted || e.code() == std::errc::not_enough_memory;
+}
+
+// ===================
+// >> prefault_stack
+// ===================
+TEST(Realtime, PrefaultStack) {
+    uint64_t faults = UINT64_MAX;
+    try {
+        Thread thread(Thread::Attributes().prefault_stack(256 * 1024), [&faults]{
+            // Once for the stats call itself to fault in what it uses
+            this_thread::stats();
+            uint64_t before = this_thread::stats().minor_faults;
+            touch_stack(128 * 1024);
+            faults = this_thread::stats().minor_faults - before;
+        });
+        thread.join();
+    }
+    catch ( const std::system_error& e ) {
+        if ( lock_refused(e) )
+            GTEST_SKIP() << e.what();
+        throw;
+    }
+    #if FAULT_FREE
+        EXPECT_EQ(faults, 0u);
+    #endif
+}
+
+TEST(Realtime, PrefaultTooLarge) {
+    try {
+        Thread thread(Thread::Attributes().stack_size(256 * 1024).prefault_stack(1024 * 1024), []{ FAIL(); });
+        FAIL();
+    }
+    catch ( const std::system_error& e ) {
+        EXPECT_EQ(e.code(), std::errc::invalid_argument);
+    }
+}
+
+// ==========
+// >> Stats
+// ==========
+#if SIMPLY_LINUX
+    TEST(Realtime, Faults) {
+        constexpr size_t size = 8 * 1024 * 1024;
+        std::atomic<bool> touched{false}, done{false};
+        uint64_t faults = 0;
+        Thread thread([&]{
+            uint64_t before = this_thread::stats().minor_faults;
+            std::unique_ptr<char[]> memory(new char[size]);
+            std::memset(memory.get(), 1, size);
+            faults = this_thread::stats().minor_faults - before;
+            touched = true;
+            while ( !done )
+                this_thread::relax();
+        });
+        while ( !touched )
+            this_thread::relax();
+
+        // The same counts, read from outside
+        Thread::Stats stats = thread.stats();
+        done = true;
+        thread.join();
+        EXPECT_GT(faults, 0u);
+        EXPECT_GE(stats.minor_faults, faults);
+    }
+#endif
+
+// ================
+// >> lock_memory
+// ================
+TEST(Realtime, LockMemory) {
+    try {
+        lock_memory(false);
+    }
+    catch ( const std::system_error& e ) {
+        if ( lock_refused(e) )
+            GTEST_SKIP() << e.what();
+        throw;
+    }
+
+    // Everything mapped is resident, so touching it again doesn't fault
+    #if FAULT_FREE
+        static char data[64 * 1024];
+        uint64_t before = this_thread::stats().minor_faults;
+        for ( size_t at = 0; at < sizeof(data); at += 512 )
+            data[at] = 1;
+        EXPECT_EQ(this_thread::stats().minor_faults, before);
+    #endif
+    unlock_memory();
+}
@@ -0,0 +1,108 @@
+/**
+ * @file 17_spin_worker.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `SpinWorker` from `simply-threading`
+ */
+#include <simply/spin_worker.h>
+#include <simply/queue.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <system_error>
+
+using namespace simply;
+
+// ===============
+// >> SpinWorker
+// ===============
+TEST(SpinWorker, Polls) {
+    size_t cpu = this_thread::get_affinity().first();
+    SpscQueue<int, 64> queue;
+    std::atomic<int64_t> sum{0};
+    size_t seen_cpu = SIZE_MAX;
+    SpinWorker worker(cpu, SpinWorker::ANY, [&](){
+        seen_cpu = this_thread::stats().cpu;
+        int value;
+        if ( !queue.try_pop(value) )
+            return false;
+        sum.fetch_add(value, std::memory_order_relaxed);
+        return true;
+    });
+    EXPECT_TRUE(worker.joinable());
+    EXPECT_EQ(worker.cpu(), cpu);
+    EXPECT_EQ(worker.thread().get_affinity(), CpuSet({cpu}));
+    worker.set_name("spinner");
+    EXPECT_EQ(worker.thread().get_name(), "spinner");
+
+    for ( int i = 1; i <= 100; i++ )
+        while ( !queue.try_push(i) )
+            this_thread::yield();
+    while ( sum.load() != 5050 )
+        this_thread::yield();
+    worker.join();
+    EXPECT_FALSE(worker.joinable());
+    EXPECT_EQ(seen_cpu, cpu);
+
+    SpinWorker::Stats stats = worker.stats();
+    EXPECT_EQ(stats.hits, 100u);
+    EXPECT_GT(stats.polls, stats.hits);
+}
+
+TEST(SpinWorker, Stop) {
+    std::atomic<uint64_t> calls{0};
+    SpinWorker worker(this_thread::get_affinity().first(), SpinWorker::ANY, [&calls](){ calls++; });
+    while ( calls.load() < 10 )
+        this_thread::yield();
+    EXPECT_TRUE(worker.request_stop());
+    EXPECT_FALSE(worker.request_stop());
+    worker.join();
+    EXPECT_EQ(worker.stats().polls, calls.load());
+
+    SpinWorker empty;
+    EXPECT_FALSE(empty.request_stop());
+    EXPECT_EQ(empty.stats().polls, 0u);
+}
+
+TEST(SpinWorker, Placement) {
+    size_t cpu = this_thread::get_affinity().first();
+    EXPECT_TRUE(SpinWorker::check_placement(cpu, SpinWorker::ANY));
+    EXPECT_FALSE(SpinWorker::check_placement(CpuSet::max_cpus, SpinWorker::ANY));
+
+    // Refused unless the machine really isolates it
+    const Topology& machine = topology();
+    EXPECT_EQ(SpinWorker::check_placement(cpu, SpinWorker::ISOLATED), machine.isolated.test(cpu));
+    EXPECT_EQ(SpinWorker::check_placement(cpu), machine.isolated.test(cpu) && machine.nohz_full.test(cpu));
+    if ( !SpinWorker::check_placement(cpu) ) {
+        try {
+            SpinWorker worker(cpu, [](){});
+            FAIL();
+        }
+        catch ( const std::system_error& e ) {
+            EXPECT_EQ(e.code(), std::errc::invalid_argument);
+        }
+    }
+
+    // One per CPU, taken back once joined
+    {
+        SpinWorker first(cpu, SpinWorker::ANY, [](){});
+        try {
+            SpinWorker second(cpu, SpinWorker::ANY, [](){});
+            FAIL();
+        }
+        catch ( const std::system_error& e ) {
+            EXPECT_EQ(e.code(), std::errc::device_or_resource_busy);
+        }
+
+        // Moving keeps the claim with the worker
+        SpinWorker moved(std::move(first));
+        EXPECT_EQ(moved.cpu(), cpu);
+    }
+    SpinWorker again(cpu, SpinWorker::ANY, [](){});
+    EXPECT_TRUE(again.joinable());
+}
@@ -0,0 +1,236 @@
+/**
+ * @file 18_thread_cache.cpp
+ * @author Ferdinand Tonby-Strandborg
+ * @version 0.0.1-alpha
+ * @date 2026-10-14
+ * @copyright Copyright (c) 2025 Ferdinand Tonby-Strandborg. Licensed under the MIT license.
+ *
+ * Tests for class `ThreadCache` from `simply-threading`
+ */
+#include <simply/threading.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+using namespace simply;
+
+// A joined thread parks once it has put itself back, which may be just after
+static size_t parked_after(size_t expected) {
+    for ( int k = 0; k < 1000 && ThreadCache::stats().parked != expected; k++ )
+        this_thread::sleep(1);
+    return ThreadCache::stats().parked;
+}
+
+// ============
+// >> Reuse
+// ============
+TEST(ThreadCache, Reuse) {
+    ThreadCache::enable(4, std::chrono::seconds(10));
+    ThreadCache::Stats before = ThreadCache::stats();
+    Thread::id first, second;
+    Thread([&first]{ first = this_thread::get_id(); }).join();
+    parked_after(1);
+    Thread([&second]{ second = this_thread::get_id(); }).join();
+    EXPECT_EQ(first, second);
+
+    ThreadCache::Stats after = ThreadCache::stats();
+    EXPECT_EQ(after.spawned - before.spawned, 1u);
+    EXPECT_EQ(after.reused - before.reused, 1u);
+    EXPECT_EQ(parked_after(1), 1u);
+
+    ThreadCache::disable();
+}
+
+TEST(ThreadCache, HeldUntilJoined) {
+    ThreadCache::enable(4, std::chrono::seconds(10));
+    // The first Thread still holds its thread, so the second gets a new one
+    Thread first([]{});
+    Thread second([]{});
+    EXPECT_NE(first.get_id(), second.get_id());
+    first.join();
+    second.join();
+    EXPECT_EQ(parked_after(2), 2u);
+
+    ThreadCache::disable();
+}
+
+TEST(ThreadCache, MaxParked) {
+    ThreadCache::enable(1);
+    {
+        Thread first([]{});
+        Thread second([]{});
+    }
+    EXPECT_EQ(parked_after(1), 1u);
+
+    ThreadCache::disable();
+}
+
+TEST(ThreadCache, Attributes) {
+    ThreadCache::enable(4, std::chrono::seconds(10));
+    // Asking for a set-up thread always gets a new one
+    Thread([]{}).join();
+    parked_after(1);
+    ThreadCache::Stats before = ThreadCache::stats();
+    Thread(Thread::Attributes().name("fresh"), []{}).join();
+    EXPECT_EQ(ThreadCache::stats().reused, before.reused);
+
+    ThreadCache::disable();
+}
+
+// ===========
+// >> Join
+// ===========
+TEST(ThreadCache, JoinWaits) {
+    ThreadCache::enable(4, std::chrono::seconds(10));
+    std::atomic<bool> done{false};
+    Thread thread([&done]{
+        this_thread::sleep(20);
+        done = true;
+    });
+    EXPECT_TRUE(thread.joinable());
+    thread.join();
+    EXPECT_TRUE(done);
+    EXPECT_FALSE(thread.joinable());
+
+    ThreadCache::disable();
+}
+
+TEST(ThreadCache, JoinFor) {
+    ThreadCache::enable(4, std::chrono::seconds(10));
+    std::atomic<bool> release{false};
+    Thread thread([&release]{
+        while ( !release )
+            this_thread::sleep(1);
+    });
+    EXPECT_FALSE(thread.join_for(std::chrono::milliseconds(10)));
+    EXPECT_TRUE(thread.joinable());
+    release = true;
+    EXPECT_TRUE(thread.join_for(std::chrono::seconds(10)));
+
+    ThreadCache::disable();
+}
+
+TEST(ThreadCache, Detach) {
+    ThreadCache::enable(4, std::chrono::seconds(10));
+    std::atomic<bool> done{false};
+    Thread thread([&done]{ done = true; });
+    thread.detach();
+    EXPECT_FALSE(thread.joinable());
+    while ( !done )
+        this_thread::relax();
+
+    // Parked once the function returned, for the next Thread
+    EXPECT_EQ(parked_after(1), 1u);
+
+    ThreadCache::disable();
+}
+
+#if SIMPLY_std20plus
+    TEST(ThreadCache, StopToken) {
+        ThreadCache::enable(4, std::chrono::seconds(10));
+        for ( int k = 0; k < 2; k++ ) {
+            // Each run gets its own token, not the stop of the last
+            std::atomic<bool> started{false};
+            Thread thread([&started](std::stop_token token){
+                EXPECT_FALSE(token.stop_requested());
+                started = true;
+                while ( !token.stop_requested() )
+                    this_thread::sleep(1);
+            });
+            while ( !started )
+                this_thread::relax();
+            thread.join();
+            parked_after(1);
+        }
+        EXPECT_GE(ThreadCache::stats().reused, 1u);
+
+        ThreadCache::disable();
+    }
+#endif
+
+TEST(ThreadCache, Stats) {
+    ThreadCache::enable(4, std::chrono::seconds(10));
+    ThreadCache::Stats before = ThreadCache::stats();
+    // Sampled while the function blocks, on a new thread and then a parked one
+    for ( int k = 0; k < 2; k++ ) {
+        std::atomic<bool> done{false};
+        Thread thread([&done]{
+            while ( !done )
+                this_thread::sleep(1);
+        });
+        this_thread::sleep(5);
+        Thread::Stats stats = thread.stats();
+        EXPECT_LT(stats.cpu, CpuSet::max_cpus);
+        #if SIMPLY_LINUX
+            EXPECT_GT(stats.voluntary_switches, 0u);
+        #endif
+        done = true;
+        thread.join();
+        parked_after(1);
+    }
+    EXPECT_EQ(ThreadCache::stats().reused - before.reused, 1u);
+
+    ThreadCache::disable();
+}
+
+// ==============
+// >> Restoring
+// ==============
+TEST(ThreadCache, Restored) {
+    ThreadCache::enable(4, std::chrono::seconds(10));
+    // Each run waits for the last to park, so all can go on the same thread
+    ThreadCache::Stats before = ThreadCache::stats();
+    auto run = [](auto f){
+        Thread(f).join();
+        parked_after(1);
+    };
+
+    std::string name;
+    run([]{ this_thread::set_name("changed"); });
+    run([&name]{ name = this_thread::get_name(); });
+    EXPECT_NE(name, "changed");
+
+    CpuSet affinity, process = this_thread::get_affinity();
+    run([]{ this_thread::set_affinity(CpuSet({0})); });
+    run([&affinity]{ affinity = this_thread::get_affinity(); });
+    EXPECT_EQ(affinity, process);
+
+    Thread::QoS qos = Thread::QoS::BACKGROUND;
+    run([]{ this_thread::set_qos(Thread::QoS::EFFICIENCY); });
+    run([&qos]{ qos = this_thread::get_qos(); });
+    EXPECT_EQ(qos, Thread::QoS::DEFAULT);
+
+    // All put back, so none was replaced
+    EXPECT_EQ(ThreadCache::stats().spawned - before.spawned, 1u);
+
+    ThreadCache::disable();
+}
+
+// ==============
+// >> Lifetime
+// ==============
+TEST(ThreadCache, IdleTimeout) {
+    ThreadCache::enable(4, std::chrono::milliseconds(10));
+    Thread([]{}).join();
+    EXPECT_EQ(parked_after(0), 0u);
+
+    ThreadCache::disable();
+}
+
+TEST(ThreadCache, Disable) {
+    ThreadCache::enable(4, std::chrono::seconds(10));
+    Thread([]{}).join();
+    EXPECT_EQ(parked_after(1), 1u);
+    ThreadCache::disable();
+    EXPECT_FALSE(ThreadCache::enabled());
+    EXPECT_EQ(ThreadCache::stats().parked, 0u);
+
+    // Held threads exit once done with, rather than park
+    ThreadCache::Stats before = ThreadCache::stats();
+    Thread([]{}).join();
+    EXPECT_EQ(ThreadCache::stats().spawned, before.spawned);
+    EXPECT_EQ(ThreadCache::stats().parked, 0u);
+}